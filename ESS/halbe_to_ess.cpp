@@ -109,8 +109,163 @@ namespace HMF
 {
 //functions for internal structures
 
+namespace {
+
+// Conversions between HALbe rows and the HAL2ESS datastructure of one HICANN
+// (HALaccess::wafer().hicanns), shared by the row-wise and the bulk functions.
+
+// index of the v-line of a crossbar row in the ESS configuration of its side
+size_t crossbar_vline(halco::hicann::v2::HLineOnHICANN const& y, halco::common::Side const s, size_t const i)
+{
+	halco::hicann::v2::VLineOnHICANN const vline = y.toVLineOnHICANN(s, halco::common::Enum{i});
+	// keep in mind the different numbering of vlines on the right side
+	if (s == halco::common::left)
+		return revert_vbus(vline) / 32;
+	return (revert_vbus(vline) % 128) / 32;
+}
+
+template <typename HicannData>
+void write_crossbar_row(
+	HicannData& hica,
+	halco::hicann::v2::HLineOnHICANN const& y,
+	halco::common::Side const s,
+	HICANN::CrossbarRow const& switches)
+{
+	auto& row = hica.crossbar_config[s == halco::common::left ? 0 : 1][revert_hbus(y)];
+	assert(switches.size() == row.size());
+	for (size_t i = 0; i < switches.size(); ++i)
+		row.at(crossbar_vline(y, s, i)) = switches[i];
+}
+
+template <typename HicannData>
+HICANN::CrossbarRow read_crossbar_row(
+	HicannData& hica, halco::hicann::v2::HLineOnHICANN const& y, halco::common::Side const s)
+{
+	HICANN::CrossbarRow returnval;
+	auto const& row = hica.crossbar_config[s == halco::common::left ? 0 : 1][revert_hbus(y)];
+	assert(returnval.size() == row.size());
+	for (size_t i = 0; i < returnval.size(); ++i)
+		returnval[i] = row.at(crossbar_vline(y, s, i));
+	return returnval;
+}
+
+// in HALbe the synapse switch rows are numbered from 0 to 223 without distinction between
+// up/down whereas in the ESS they are numbered from 0 to 111 per block TODO check if correct
+size_t synswitch_column(halco::hicann::v2::SynapseSwitchRowOnHICANN const& s, size_t const i)
+{
+	return s.toSideHorizontal() == halco::common::left ? i : 15 - i;
+}
+
+template <typename HicannData>
+void write_synswitch_row(
+	HicannData& hica,
+	halco::hicann::v2::SynapseSwitchRowOnHICANN const& s,
+	HICANN::SynapseSwitchRow const& switches)
+{
+	size_t synbl;
+	size_t addr;
+	format_synswitch(s, synbl, addr);
+	auto& config = hica.synswitch_config[synbl][addr];
+	assert(config.size() == switches.size());
+	for (size_t i = 0; i < config.size(); ++i)
+		config.at(synswitch_column(s, i)) = switches[i];
+}
+
+template <typename HicannData>
+HICANN::SynapseSwitchRow read_synswitch_row(
+	HicannData& hica, halco::hicann::v2::SynapseSwitchRowOnHICANN const& s)
+{
+	size_t synbl;
+	size_t addr;
+	format_synswitch(s, synbl, addr);
+	HICANN::SynapseSwitchRow returnval;
+	auto const& config = hica.synswitch_config[synbl][addr];
+	assert(config.size() == returnval.size());
+	for (size_t i = 0; i < config.size(); ++i)
+		returnval[i] = config.at(synswitch_column(s, i));
+	return returnval;
+}
+
+// returns the number of non-zero weights
+template <typename HicannData>
+size_t write_weights_row(
+	HicannData& hica,
+	halco::hicann::v2::SynapseRowOnHICANN const& s,
+	HICANN::WeightRow const& weights)
+{
+	size_t const row_addr = format_synapse_row(s);
+	size_t nonzero = 0;
+	for (size_t i = 0; i < weights.size(); ++i) {
+		hica.set_syn_weight(std::bitset<4>(weights[i].value()), row_addr, i);
+		nonzero += weights[i].value() != 0;
+	}
+	return nonzero;
+}
+
+template <typename HicannData>
+HICANN::WeightRow read_weights_row(HicannData& hica, halco::hicann::v2::SynapseRowOnHICANN const& s)
+{
+	size_t const row_addr = format_synapse_row(s);
+	HICANN::WeightRow returnval;
+	for (size_t i = 0; i < returnval.size(); ++i)
+		returnval[i] = HICANN::SynapseWeight::from_bitset(hica.get_syn_weight(row_addr, i));
+	return returnval;
+}
+
+size_t synapse_row_address(
+	halco::hicann::v2::SynapseDriverOnHICANN const& s, halco::hicann::v2::RowOnSynapseDriver const& row)
+{
+	return format_synapse_row(halco::hicann::v2::SynapseRowOnHICANN{s, row});
+}
+
+// returns the number of non-blocking decoders
+template <typename HicannData>
+size_t write_decoder_double_row(
+	HicannData& hica,
+	halco::hicann::v2::SynapseDriverOnHICANN const& s,
+	HICANN::DecoderDoubleRow const& data)
+{
+	size_t const top = synapse_row_address(s, halco::hicann::v2::RowOnSynapseDriver{halco::common::top});
+	size_t const bot = synapse_row_address(s, halco::hicann::v2::RowOnSynapseDriver{halco::common::bottom});
+	size_t non_blocking = 0;
+	for (size_t i = 0; i < data[halco::common::top].size(); ++i) {
+		hica.set_syn_address(std::bitset<4>(data[halco::common::top][i].value()), top, i);
+		hica.set_syn_address(std::bitset<4>(data[halco::common::bottom][i].value()), bot, i);
+		// 1 = mapping blocking value TODO shouldnt be a magic number here
+		non_blocking += (data[halco::common::top][i].value() != 1) +
+		                (data[halco::common::bottom][i].value() != 1);
+	}
+	return non_blocking;
+}
+
+template <typename HicannData>
+HICANN::DecoderDoubleRow read_decoder_double_row(
+	HicannData& hica, halco::hicann::v2::SynapseDriverOnHICANN const& s)
+{
+	size_t const top = synapse_row_address(s, halco::hicann::v2::RowOnSynapseDriver{halco::common::top});
+	size_t const bot = synapse_row_address(s, halco::hicann::v2::RowOnSynapseDriver{halco::common::bottom});
+	HICANN::DecoderDoubleRow returnval;
+	for (size_t i = 0; i < returnval[halco::common::top].size(); ++i) {
+		returnval[halco::common::top][i] = HICANN::SynapseDecoder::from_bitset(hica.get_syn_address(top, i));
+		returnval[halco::common::bottom][i] = HICANN::SynapseDecoder::from_bitset(hica.get_syn_address(bot, i));
+	}
+	return returnval;
+}
+
+} // namespace
+
 const int HAL2ESS::num_wafer;
 
+/// DNC-to-FPGA and HICANN configuration of the PCB, which only depends on
+/// coordinates except for the availability of the HICANNs.
+struct HAL2ESS::PCBTopology
+{
+	typedef boost::tuples::tuple<bool, unsigned int, int, int> hic_config_type;
+
+	std::vector<std::vector<int> > dnc_to_fpga;
+	std::vector<std::vector<hic_config_type> > hic_config;
+};
+
 //Constructor
 HAL2ESS::HAL2ESS(halco::hicann::v2::Wafer wafer, std::string filepath)
     : mWafer{wafer}
@@ -120,6 +275,8 @@ HAL2ESS::HAL2ESS(halco::hicann::v2::Wafer wafer, std::string filepath)
     , mhal_access{new HALaccess(wafer.value(), mfilepath)}
     , mvirtual_hw{new Stage2VirtualHardware{"Virtual_FACETS_Stage2_Hardware", num_wafer, mfilepath}}
     , mpulse_statistics_file("")
+    , mconsistency_check(true)
+    , mpcb_topology()
     , mFPGAdata(mNumFPGAs)
     , mFPGAConfig(mNumFPGAs)
 {
@@ -145,63 +302,62 @@ void HAL2ESS::initialize_sim()
 	const unsigned int hicann_y = mhal_access->wafer().num_y_hicanns;
 	const unsigned int dnc_count = mhal_access->wafer().num_dncs;
 	const unsigned int fpga_count = mNumFPGAs;
-	std::vector<std::vector<int> > dnc_to_fpga;
-	std::vector<std::vector<boost::tuples::tuple<bool, unsigned int, int, int> > > hic_config;
 
-	//initialize hic_config
-	boost::tuples::tuple<bool, unsigned int, int, int> init(false,0,0,0);
-	std::vector<boost::tuples::tuple<bool, unsigned int, int, int> > temp;
-	temp.resize(hicann_x,init);
-	hic_config.resize(hicann_y,temp);
+	// the topology is reused by subsequent runs, only the availability has to be updated
+	if (!mpcb_topology)
+	{
+		std::unique_ptr<PCBTopology> topology(new PCBTopology);
 
-	//initialize dnc_to_fpga
-	dnc_to_fpga.resize(fpga_count, std::vector<int>() );
+		//initialize hic_config
+		PCBTopology::hic_config_type init(false,0,0,0);
+		topology->hic_config.resize(hicann_y, std::vector<PCBTopology::hic_config_type>(hicann_x, init));
 
-	for (auto & fp : dnc_to_fpga) {
-		fp.resize(4, -1);
-	}
+		//initialize dnc_to_fpga
+		topology->dnc_to_fpga.resize(fpga_count, std::vector<int>(4, -1));
 
-	//configure hic_config and dnc_to_fpga
-	for(size_t n_y = 0; n_y < hicann_y ; ++n_y )
-	{
-		for(size_t n_x = 0; n_x < hicann_x ; ++n_x )
+		//configure hic_config and dnc_to_fpga for all valid combinations of x and y
+		for (auto hicann : halco::common::iter_all<halco::hicann::v2::HICANNOnWafer>())
 		{
-			auto it = std::find(halco::hicann::v2::HICANNOnWaferGrid.begin(), halco::hicann::v2::HICANNOnWaferGrid.end(), std::pair<int,int>(n_x, n_y));
-			if( it != halco::hicann::v2::HICANNOnWaferGrid.end())	//check if nx and ny is a valid combination
-			{
-				//determine the hicann_id
-				halco::common::XRanged<35,0> x(n_x);
-				halco::common::YRanged<15,0> y(n_y);
-				halco::hicann::v2::HICANNGlobal hicann_c(x, y, mWafer);
-				unsigned int hicann_id = hicann_c.toHICANNOnWafer().toEnum();
-				//determeine if hicann was initialized
-				bool available = mhal_access->wafer().hicanns[hicann_id].available;
-
-                //determine the parent DNC of this hicann
-				int dnc_id = hicann_c.toDNCOnWafer().toEnum();
-                //determine the Hicann-DNC-Channel and the DNC-FPGA-Channel
-				auto hod = hicann_c.toHICANNOnDNC();
-				int hicann_channel  = hod.x()*2 + hod.y(); // convert to numbering on DNC
-				int channel = hicann_c.toDNCOnFPGA();
-				
-				//write configuration data to hic_config
-	            LOG4CXX_DEBUG(_logger, "config channel (=dnc_on_fpga id) =" << channel << " hicann_channel: " << hicann_channel << " for hicann " << hicann_id << " dnc: " << dnc_id );
-				boost::tuples::tuple<bool, unsigned int, int, int> conf(available, hicann_id, dnc_id, hicann_channel);
-				hic_config[n_y][n_x] = conf;
-
-				//config dnc_to_fpga
-                //TODO Log this
-                halco::hicann::v2::FPGAOnWafer fpga_c = hicann_c.toFPGAOnWafer();
-				size_t fpga_id = fpga_c.value();
-				dnc_to_fpga.at(fpga_id).at(channel) = dnc_id;
-
-				assert(dnc_to_fpga.at(fpga_id).size() <= 4);
-			}
+			size_t const n_x = hicann.x();
+			size_t const n_y = hicann.y();
+			if (n_x >= hicann_x || n_y >= hicann_y)
+				continue;
+
+			halco::hicann::v2::HICANNGlobal hicann_c(hicann, mWafer);
+			unsigned int hicann_id = hicann.toEnum();
+
+			//determine the parent DNC of this hicann
+			int dnc_id = hicann_c.toDNCOnWafer().toEnum();
+			//determine the Hicann-DNC-Channel and the DNC-FPGA-Channel
+			auto hod = hicann_c.toHICANNOnDNC();
+			int hicann_channel  = hod.x()*2 + hod.y(); // convert to numbering on DNC
+			int channel = hicann_c.toDNCOnFPGA();
+
+			//write configuration data to hic_config
+			LOG4CXX_DEBUG(_logger, "config channel (=dnc_on_fpga id) =" << channel << " hicann_channel: " << hicann_channel << " for hicann " << hicann_id << " dnc: " << dnc_id );
+			topology->hic_config[n_y][n_x] = PCBTopology::hic_config_type(false, hicann_id, dnc_id, hicann_channel);
+
+			//config dnc_to_fpga
+			halco::hicann::v2::FPGAOnWafer fpga_c = hicann_c.toFPGAOnWafer();
+			size_t fpga_id = fpga_c.value();
+			topology->dnc_to_fpga.at(fpga_id).at(channel) = dnc_id;
+
+			assert(topology->dnc_to_fpga.at(fpga_id).size() <= 4);
 		}
+		mpcb_topology = std::move(topology);
+	}
+
+	//determine if hicanns were initialized
+	for (auto hicann : halco::common::iter_all<halco::hicann::v2::HICANNOnWafer>())
+	{
+		if (hicann.x() >= hicann_x || hicann.y() >= hicann_y)
+			continue;
+		boost::tuples::get<0>(mpcb_topology->hic_config[hicann.y()][hicann.x()]) =
+			mhal_access->wafer().hicanns[hicann.toEnum()].available;
 	}
 
 	//write config to Stage2Virtual_HW Instance
-	mvirtual_hw->initialize_pcb(id, hicann_x, hicann_y, dnc_count, fpga_count, dnc_to_fpga, hic_config, mhal_access.get(), mFPGAConfig, mDNCConfig);
+	mvirtual_hw->initialize_pcb(id, hicann_x, hicann_y, dnc_count, fpga_count, mpcb_topology->dnc_to_fpga, mpcb_topology->hic_config, mhal_access.get(), mFPGAConfig, mDNCConfig);
 }
 
 //setting the speedup
@@ -258,6 +414,12 @@ void HAL2ESS::run_sim(long duration_in_ns)
 		LostEventLogger::print_summary_to_file(mpulse_statistics_file);
 }
 
+//enables the comparison of the HAL2ESS datastructure with the simulator state in getters
+void HAL2ESS::enable_consistency_check(bool const enable)
+{
+	mconsistency_check = enable;
+}
+
 //*****************
 //backend functions
 //*****************
@@ -273,37 +435,8 @@ void HAL2ESS::set_crossbar_switch_row(Handle::HICANN const& h, halco::hicann::v2
 	auto e = h.coordinate().toHICANNOnWafer().toEnum();
 	size_t hic_id = static_cast<size_t>(e);
 
-	size_t hbus = revert_hbus(y_);
-	size_t side;
-    
-    if(s == halco::common::left) //left side, numbering of vlines identical 
-    {
-        side = 0;
-	    LOG4CXX_DEBUG(_logger, "set_crossbar_switch_row: Transformed HALbe-Address: Side " << s << " HLine " << y_.value() << " to ESS-Address: Side: " << side << " Row: " <<  hbus );
-	    auto &config = mhal_access->wafer().hicanns[hic_id].crossbar_config[side];
-	    assert(switches.size() == config[hbus].size() );
-	    for(size_t i = 0; i < switches.size(); ++i)
-	    {
-            halco::hicann::v2::VLineOnHICANN vline = y_.toVLineOnHICANN(s, halco::common::Enum{i});
-            size_t v = revert_vbus(vline)/32;
-	        LOG4CXX_TRACE(_logger, "set_crossbar_switch_row: Transformed HALbe-Address: VLine " << vline.value() << " to ESS-Address: Line: " << v );
-            config[hbus].at(v) = switches[i];
-	    }
-    }
-	else                    //right side, keep in mind different numbering of vlines in ESS and HALBE
-    {
-		side = 1;
-	    LOG4CXX_DEBUG(_logger, "set_crossbar_switch_row: Transformed HALbe-Address: Side " << s << " HLine " << y_.value() << " to ESS-Address: Side: " << side << " Row: " <<  hbus );
-	    auto &config = mhal_access->wafer().hicanns[hic_id].crossbar_config[side];
-	    assert(switches.size() == config[hbus].size() );
-	    for(size_t i = 0; i < switches.size(); ++i)
-	    {
-            halco::hicann::v2::VLineOnHICANN vline = y_.toVLineOnHICANN(s, halco::common::Enum{i});
-		    size_t v = (revert_vbus(vline)%128)/32;
-	        LOG4CXX_TRACE(_logger, "set_crossbar_switch_row: Transformed HALbe-Address: VLine " << vline.value() << " to ESS-Address: Line: " << v );
-            config[hbus].at(v) = switches[i];
-    	}   
-    }
+	LOG4CXX_DEBUG(_logger, "set_crossbar_switch_row: Transformed HALbe-Address: Side " << s << " HLine " << y_.value() << " to ESS-Address: Side: " << (s == halco::common::left ? 0 : 1) << " Row: " << revert_hbus(y_) );
+	write_crossbar_row(mhal_access->wafer().hicanns[hic_id], y_, s, switches);
 }
 
 
@@ -314,38 +447,13 @@ HICANN::CrossbarRow HAL2ESS::get_crossbar_switch_row(Handle::HICANN const& h, ha
 	auto e = h.coordinate().toHICANNOnWafer().toEnum();
 	auto hic_id = static_cast<size_t>(e);
 
-	HICANN::CrossbarRow returnval;
-	size_t hbus = revert_hbus(y_);
-    size_t side;
-
-    if(s == halco::common::left) //left side, numbering of vlines identical
-    {
-        side = 0;
-        const auto &config = mhal_access->wafer().hicanns[hic_id].crossbar_config[side];
-	    assert(returnval.size() == config[hbus].size());
-	    for(size_t i = 0; i < returnval.size(); ++i)
-	    {
-            halco::hicann::v2::VLineOnHICANN vline = y_.toVLineOnHICANN(s, halco::common::Enum{i});
-		    size_t v = revert_vbus(vline)/32;
-            returnval[i] = config[hbus].at(v);
-	    }
-    }
-    else                    //right side, keep in mind different numbering of vlines
-    {
-        side = 1;
-        const auto &config = mhal_access->wafer().hicanns[hic_id].crossbar_config[side];
-	    assert(returnval.size() == config[hbus].size());
-	    for(size_t i = 0; i < returnval.size(); ++i)
-	    {
-            halco::hicann::v2::VLineOnHICANN vline = y_.toVLineOnHICANN(s, halco::common::Enum{i});
-		    size_t v = (revert_vbus(vline)%128)/32;
-            returnval[i] = config[hbus].at(v);
-        }
-    }
+	HICANN::CrossbarRow returnval = read_crossbar_row(mhal_access->wafer().hicanns[hic_id], y_, s);
 	// getting the cbsrow from the ESS and asserting equality
-	HICANN::CrossbarRow returnval_ESS = get_crossbar_switch_row_ESS(h,y_,s);
-	(void) returnval_ESS; 	//avoid warning
-	assert(returnval == returnval_ESS);
+	if (mconsistency_check) {
+		HICANN::CrossbarRow returnval_ESS = get_crossbar_switch_row_ESS(h,y_,s);
+		(void) returnval_ESS; 	//avoid warning
+		assert(returnval == returnval_ESS);
+	}
 	return returnval;
 }
 
@@ -357,27 +465,10 @@ void HAL2ESS::set_syndriver_switch_row(Handle::HICANN const& h, halco::hicann::v
 	auto e = h.coordinate().toHICANNOnWafer().toEnum();
 	auto hic_id = static_cast<size_t>(e);
 
-	//convert HALBE-Numbering to ESS-Numbering
-	size_t synbl;
-	size_t addr;
-    format_synswitch(s, synbl, addr);
 	LOG4CXX_TRACE(_logger,
-	              "set_syndriver_switch_row: Transformed HALbe-Address: Side "
-	                  << s.toSideHorizontal() << " SynSwitchRow: " << s.line().value()
-	                  << " to ESS-Address: Block: " << synbl << " Row: " << addr);
-
-	//copy configuration
-	auto &config = mhal_access->wafer().hicanns[hic_id].synswitch_config[synbl][addr];
-	assert(config.size() == switches.size());
-	for(size_t i = 0; i < config.size(); ++i)
-	{
-        size_t j;
-        if(s.toSideHorizontal() == halco::common::left)    //TODO check if this is correct!
-            j = i;
-        else 
-            j = 15 - i;
-        config.at(j) = switches[i];
-	}
+	              "set_syndriver_switch_row: Side " << s.toSideHorizontal()
+	                  << " SynSwitchRow: " << s.line().value());
+	write_synswitch_row(mhal_access->wafer().hicanns[hic_id], s, switches);
 }
 
 
@@ -388,27 +479,13 @@ HICANN::SynapseSwitchRow HAL2ESS::get_syndriver_switch_row(Handle::HICANN const&
 	auto e = h.coordinate().toHICANNOnWafer().toEnum();
 	auto hic_id = static_cast<size_t>(e);
 
-	//convert HALBE-Numbering to ESS-Numbering
-	size_t synbl;
-	size_t addr;
-    format_synswitch(s, synbl, addr);
-
-	HICANN::SynapseSwitchRow returnval;
-	const auto &config = mhal_access->wafer().hicanns[hic_id].synswitch_config[synbl][addr];
-	assert(config.size() == returnval.size());
-	for(size_t i = 0; i < config.size(); ++i)
-	{
-        size_t j;
-        if(s.toSideHorizontal() == halco::common::left)    //TODO check if this is correct!
-            j = i;
-        else 
-            j = 15 - i;
-		returnval[i] = config.at(j);
-	}
+	HICANN::SynapseSwitchRow returnval = read_synswitch_row(mhal_access->wafer().hicanns[hic_id], s);
 	// getting the synswitch row from te ess and asserting equality
-	HICANN::SynapseSwitchRow returnval_ESS = get_syndriver_switch_row_ESS(h, s);
-	(void) returnval_ESS;
-	assert(returnval == returnval_ESS);
+	if (mconsistency_check) {
+		HICANN::SynapseSwitchRow returnval_ESS = get_syndriver_switch_row_ESS(h, s);
+		(void) returnval_ESS;
+		assert(returnval == returnval_ESS);
+	}
 	return returnval;
 }
 
@@ -419,19 +496,9 @@ void HAL2ESS::set_weights_row(Handle::HICANN const& h, HICANN::SynapseController
 	auto e = h.coordinate().toHICANNOnWafer().toEnum();
 	auto hic_id = static_cast<size_t>(e);
 
-	//calculate the address
-	size_t row_addr = format_synapse_row(s);
-    LOG4CXX_DEBUG(_logger, "set_weights_row: Transformed HALbe-Address: SynapseRow " << s.value() << " to ESS-Address: Row: " << row_addr );
-
-	for(size_t i = 0; i < weights.size(); ++i)
-	{
-        std::bitset<4> w(weights[i].value());
-        mhal_access->wafer().hicanns[hic_id].set_syn_weight(w, row_addr, i);
-	    if(w.to_ulong() != 0)
-        {
-            LOG4CXX_DEBUG(_logger, "set_weights_row: Weight in column " << i << " set to " << w.to_ulong() );
-        }
-    }
+	LOG4CXX_DEBUG(_logger, "set_weights_row: Transformed HALbe-Address: SynapseRow " << s.value() << " to ESS-Address: Row: " << format_synapse_row(s) );
+	size_t const nonzero = write_weights_row(mhal_access->wafer().hicanns[hic_id], s, weights);
+	LOG4CXX_DEBUG(_logger, "set_weights_row: " << nonzero << " non-zero weights set");
 }
 
 void HAL2ESS::set_weights_row(std::vector<boost::shared_ptr<Handle::HICANN> > handles, std::vector<HICANN::SynapseController> const&, halco::hicann::v2::SynapseRowOnHICANN const& s, std::vector<HICANN::WeightRow> const& data)
@@ -451,21 +518,14 @@ HICANN::WeightRow HAL2ESS::get_weights_row(Handle::HICANN const& h, HICANN::Syna
 	auto e = h.coordinate().toHICANNOnWafer().toEnum();
 	auto hic_id = static_cast<size_t>(e);
 
-	HICANN::WeightRow returnval;
-
-	//calculate the address
-	size_t row_addr = format_synapse_row(s);
-
-	for(size_t i = 0; i < returnval.size(); ++i)
-	{
-		auto w = HICANN::SynapseWeight::from_bitset(mhal_access->wafer().hicanns[hic_id].get_syn_weight(row_addr, i));
-		returnval[i] = w;
-	}
+	HICANN::WeightRow returnval = read_weights_row(mhal_access->wafer().hicanns[hic_id], s);
 	//getting the weight row from the ESS and asserting equality
-	HICANN::WeightRow returnval_ESS = get_weights_row_ESS(h,s);
-	(void) returnval_ESS;
-	assert(returnval == returnval_ESS);
-	return returnval_ESS;
+	if (mconsistency_check) {
+		HICANN::WeightRow returnval_ESS = get_weights_row_ESS(h,s);
+		(void) returnval_ESS;
+		assert(returnval == returnval_ESS);
+	}
+	return returnval;
 }
 
 //sets the decoder-value 
@@ -475,30 +535,9 @@ void HAL2ESS::set_decoder_double_row(Handle::HICANN const& h, HICANN::SynapseCon
 	auto e = h.coordinate().toHICANNOnWafer().toEnum();
 	auto hic_id = static_cast<size_t>(e);
 
-	//calculate the address
-    halco::hicann::v2::SynapseRowOnHICANN top_row{s, halco::hicann::v2::RowOnSynapseDriver{halco::common::top}};
-    halco::hicann::v2::SynapseRowOnHICANN bot_row{s, halco::hicann::v2::RowOnSynapseDriver{halco::common::bottom}};
-    size_t top = format_synapse_row(top_row);
-	size_t bot = format_synapse_row(bot_row);
-    
-    LOG4CXX_DEBUG(_logger, "set_decoder_double_row: Transformed HALbe-Address: SynapseDriver " << s.line().value() << " to ESS-Address: TopRow: " << top << " BotRow: " << bot );
-
-	auto &hica = mhal_access->wafer().hicanns[hic_id];
-	for(size_t i = 0; i < data[halco::common::top].size(); ++i)
-	{
-		if (data[halco::common::top][i].value() !=
-		    1) { // 1 = mapping blocking value TODO shouldnt be a magic number here
-			LOG4CXX_DEBUG(_logger, "set_decoder_double_row: top row decoder set to " << (int)data[halco::common::top][i].value() << " in column " << i );
-		}
-		std::bitset<4> addr_top(data[halco::common::top][i].value());
-        hica.set_syn_address(addr_top, top, i);
-		if (data[halco::common::bottom][i].value() !=
-		    1) { // 1 = mapping blocking value TODO shouldnt be a magic number here
-			LOG4CXX_DEBUG(_logger, "set_decoder_double_row: bottom row decoder set to " << (int)data[halco::common::bottom][i].value() << " in column " << i );
-		}
-		std::bitset<4> addr_bot(data[halco::common::bottom][i].value());
-        hica.set_syn_address(addr_bot, bot, i);
-	}
+	LOG4CXX_DEBUG(_logger, "set_decoder_double_row: Transformed HALbe-Address: SynapseDriver " << s.line().value() << " to ESS-Address: TopRow: " << synapse_row_address(s, halco::hicann::v2::RowOnSynapseDriver{halco::common::top}) << " BotRow: " << synapse_row_address(s, halco::hicann::v2::RowOnSynapseDriver{halco::common::bottom}) );
+	size_t const non_blocking = write_decoder_double_row(mhal_access->wafer().hicanns[hic_id], s, data);
+	LOG4CXX_DEBUG(_logger, "set_decoder_double_row: " << non_blocking << " non-blocking decoders set");
 }
 
 void HAL2ESS::set_decoder_double_row(std::vector<boost::shared_ptr<Handle::HICANN> > handles, std::vector<HICANN::SynapseController> const&, halco::hicann::v2::SynapseDriverOnHICANN const& syndrv, std::vector<HICANN::DecoderDoubleRow> const& data)
@@ -513,30 +552,17 @@ void HAL2ESS::set_decoder_double_row(std::vector<boost::shared_ptr<Handle::HICAN
 //gets the decoder value
 HICANN::DecoderDoubleRow HAL2ESS::get_decoder_double_row(Handle::HICANN const& h, HICANN::SynapseController const&, halco::hicann::v2::SynapseDriverOnHICANN const& s)
 {
-	HICANN::DecoderDoubleRow returnval;
-
 	//Calculate the hicann coordinate
 	auto e = h.coordinate().toHICANNOnWafer().toEnum();
 	auto hic_id = static_cast<size_t>(e);
 
-	//calculate the address
-    halco::hicann::v2::SynapseRowOnHICANN top_row{s, halco::hicann::v2::RowOnSynapseDriver{halco::common::top}};
-    halco::hicann::v2::SynapseRowOnHICANN bot_row{s, halco::hicann::v2::RowOnSynapseDriver{halco::common::bottom}};
-    size_t top = format_synapse_row(top_row);
-	size_t bot = format_synapse_row(bot_row);
-
-	auto &hica = mhal_access->wafer().hicanns[hic_id];
-	for(size_t i = 0; i < returnval[halco::common::top].size(); ++i)
-	{
-		auto addr_top = HICANN::SynapseDecoder::from_bitset(hica.get_syn_address(top, i));
-        returnval[halco::common::top][i] = addr_top;
-		auto addr_bot = HICANN::SynapseDecoder::from_bitset(hica.get_syn_address(bot, i));
-		returnval[halco::common::bottom][i] = addr_bot;
-	}
+	HICANN::DecoderDoubleRow returnval = read_decoder_double_row(mhal_access->wafer().hicanns[hic_id], s);
 	//getting the decoder double row from the ESS and asserting equality
-	HICANN::DecoderDoubleRow returnval_ESS = get_decoder_double_row_ESS(h,s);
-	(void) returnval_ESS;
-	assert(returnval == returnval_ESS);
+	if (mconsistency_check) {
+		HICANN::DecoderDoubleRow returnval_ESS = get_decoder_double_row_ESS(h,s);
+		(void) returnval_ESS;
+		assert(returnval == returnval_ESS);
+	}
 	return returnval;
 }
 
@@ -681,6 +707,14 @@ void HAL2ESS::set_synapse_driver(Handle::HICANN const& h,
 	bot_row.gmax_div_i = drv_row[bot_line].get_gmax_div(halco::common::right);
 }
 
+void HAL2ESS::set_synapse_driver(std::vector<boost::shared_ptr<Handle::HICANN> > handles, std::vector<HICANN::SynapseController> const&, halco::hicann::v2::SynapseDriverOnHICANN const& s, std::vector<HICANN::SynapseDriver> const& data)
+{
+	for (auto v: pythonic::zip(handles, data)) {
+		// Pass generic SynapseController since not used by function in ESS
+		HICANN::SynapseController synapse_controller;
+		set_synapse_driver(*(v.first), synapse_controller, s, v.second);
+	}
+}
 
 //gets the configuration of a synapse driver and the two corresponding synrows
 HICANN::SynapseDriver HAL2ESS::get_synapse_driver(Handle::HICANN const& h,
@@ -857,9 +891,11 @@ HICANN::NeuronQuad HAL2ESS::get_denmem_quad(Handle::HICANN const& h, halco::hica
         const auto& nrn_conf = mhal_access->wafer().hicanns[hic_id].neurons_on_hicann[nrn_on_hic.toEnum()];
 		//get L1-address from datacontainer and from ESS and assert their equality
 		auto L1Addr = HICANN::L1Address(nrn_conf.l1_address);
-        auto L1Addr_ESS = get_L1Address_ESS(h, nrn_on_hic);
-		(void) L1Addr_ESS;
-		assert(L1Addr == L1Addr_ESS);
+		if (mconsistency_check) {
+			auto L1Addr_ESS = get_L1Address_ESS(h, nrn_on_hic);
+			(void) L1Addr_ESS;
+			assert(L1Addr == L1Addr_ESS);
+		}
 		nrn.address(L1Addr);
         //get flags from datacontainer
 		nrn.activate_firing(nrn_conf.activate_firing);
@@ -950,7 +986,7 @@ HICANN::FGErrorResultQuadRow HAL2ESS::wait_fg(Handle::HICANN &)
 }
 
 //sets the fg values for a single fg-block
-void HAL2ESS::set_fg_values(Handle::HICANN const& h, halco::hicann::v2::FGBlockOnHICANN const& b, HICANN::FGBlock const& fg)
+void HAL2ESS::set_fg_values(Handle::HICANN const& h, halco::hicann::v2::FGBlockOnHICANN const& b, HICANN::FGBlock const& fg, bool const)
 {
     //Calculate the hicann coordinate
 	auto e = h.coordinate().toHICANNOnWafer().toEnum();
@@ -1035,11 +1071,12 @@ void HAL2ESS::set_fg_values(Handle::HICANN const& h, halco::hicann::v2::FGBlockO
 	}
 }
     
-HICANN::FGErrorResultQuadRow HAL2ESS::set_fg_row_values(Handle::HICANN & h, halco::hicann::v2::FGRowOnFGBlock row, HICANN::FGControl const& fg, bool const, bool const)
+HICANN::FGErrorResultQuadRow HAL2ESS::set_fg_row_values(Handle::HICANN & h, halco::hicann::v2::FGRowOnFGBlock row, HICANN::FGControl const& fg, bool const, bool const, bool const)
 {
     //Calculate the hicann coordinate
 	auto e = h.coordinate().toHICANNOnWafer().toEnum();
 	auto hic_id = static_cast<size_t>(e);
+	auto & hica = mhal_access->wafer().hicanns[hic_id];
 
     LOG4CXX_DEBUG(_logger, "set_fg_row_values called for row " << row );
 
@@ -1051,33 +1088,30 @@ HICANN::FGErrorResultQuadRow HAL2ESS::set_fg_row_values(Handle::HICANN & h, halc
         //top/bot corresponds to vertical position of fgblock
         size_t vert = fg_block.y();
         
-        // get the shared parameter
+        // get the shared parameter, if this row is connected to one
         // only the shared parameters V_reset, V_stdf, V_dep, V_fac and V_dtc are used
-        try
+        if (auto const shared_param = HICANN::findSharedParameter(fg_block,row))
         {
-            HICANN::shared_parameter shared_param_type = HICANN::getSharedParameter(fg_block,row);
+            HICANN::shared_parameter shared_param_type = *shared_param;
+            ESS::SyndriverParameterHW & shrd_param = hica.syndriver_config[side].synapse_params_hw[vert];
             // V_stdf
             if (shared_param_type == HICANN::shared_parameter::V_stdf)
             {
-                ESS::SyndriverParameterHW & shrd_param = mhal_access->wafer().hicanns[hic_id].syndriver_config[side].synapse_params_hw[vert];
                 shrd_param.V_stdf = fg.getShared(fg_block,shared_param_type);
             }
             // V_dep
             else if (shared_param_type == HICANN::shared_parameter::V_dep)
             {
-                ESS::SyndriverParameterHW & shrd_param = mhal_access->wafer().hicanns[hic_id].syndriver_config[side].synapse_params_hw[vert];
                 shrd_param.V_dep = fg.getShared(fg_block,shared_param_type);
             }
             // V_fac
             else if (shared_param_type == HICANN::shared_parameter::V_fac)
             {
-                ESS::SyndriverParameterHW & shrd_param = mhal_access->wafer().hicanns[hic_id].syndriver_config[side].synapse_params_hw[vert];
                 shrd_param.V_fac = fg.getShared(fg_block,shared_param_type);
             }
             // V_dtc
             else if (shared_param_type == HICANN::shared_parameter::V_dtc)
             {
-                ESS::SyndriverParameterHW & shrd_param = mhal_access->wafer().hicanns[hic_id].syndriver_config[side].synapse_params_hw[vert];
                 shrd_param.V_dtc = fg.getShared(fg_block,shared_param_type);
             }
             // V_reset (shared neuron parameter)
@@ -1089,32 +1123,24 @@ HICANN::FGErrorResultQuadRow HAL2ESS::set_fg_row_values(Handle::HICANN & h, halc
                     halco::hicann::v2::NeuronOnQuad nrn_on_quad( halco::common::Enum(fg_block.toEnum()) );
                     halco::hicann::v2::NeuronOnHICANN nrn(quad, nrn_on_quad);
 	            	size_t addr = nrn.toEnum();
-                    auto & nrn_ess  = mhal_access->wafer().hicanns[hic_id].neurons_on_hicann[addr];
-	            	nrn_ess.V_reset = fg.getShared(fg_block,shared_param_type);
+	            	hica.neurons_on_hicann[addr].V_reset = fg.getShared(fg_block,shared_param_type);
                 }
             }
         }
-        catch (std::out_of_range&)
-        {}
         
-        //get the neuron parameter
-        // try to get the type, if this row is not connected continue
-        try
-        {
-            HICANN::neuron_parameter nrn_param_type = HICANN::getNeuronParameter(fg_block,row);
-            // set the neuron parameter
-            for (auto nrn_fg : halco::common::iter_all<halco::hicann::v2::NeuronOnFGBlock>())
-            {
-                halco::hicann::v2::NeuronOnHICANN nrn = nrn_fg.toNeuronOnHICANN(fg_block);
-                size_t nrn_id = nrn.toEnum();
-		        auto & nrn_params = mhal_access->wafer().hicanns[hic_id].neurons_on_hicann[nrn_id].neuron_parameters;
-                auto const param = fg.getNeuron(nrn, nrn_param_type);
-                nrn_params.setParam(nrn_param_type, param);
-            }
-        }
-        catch (std::out_of_range&)
-        {
+        //get the neuron parameter, if this row is not connected continue
+        auto const nrn_param = HICANN::findNeuronParameter(fg_block,row);
+        if (!nrn_param)
             continue;
+
+        HICANN::neuron_parameter nrn_param_type = *nrn_param;
+        // set the neuron parameter
+        for (auto nrn_fg : halco::common::iter_all<halco::hicann::v2::NeuronOnFGBlock>())
+        {
+            halco::hicann::v2::NeuronOnHICANN nrn = nrn_fg.toNeuronOnHICANN(fg_block);
+            size_t nrn_id = nrn.toEnum();
+            auto const param = fg.getNeuron(nrn, nrn_param_type);
+            hica.neurons_on_hicann[nrn_id].neuron_parameters.setParam(nrn_param_type, param);
         }
     }
 
@@ -1124,37 +1150,36 @@ HICANN::FGErrorResultQuadRow HAL2ESS::set_fg_row_values(Handle::HICANN & h, halc
 
 HICANN::FGErrorResultQuadRow HAL2ESS::set_fg_row_values(Handle::HICANN & h, halco::hicann::v2::FGBlockOnHICANN fg_block,
 		halco::hicann::v2::FGRowOnFGBlock row,
-		HICANN::FGRow const& fg, bool const, bool const)
+		HICANN::FGRow const& fg, bool const, bool const, bool const)
 {
 	auto e = h.coordinate().toHICANNOnWafer().toEnum();
 	auto hic_id = static_cast<size_t>(e);
+	auto & hica = mhal_access->wafer().hicanns[hic_id];
 
 	// get the block coordinates
 	size_t side = fg_block.x();
 	//top/bot corresponds to vertical position of fgblock
 	size_t vert = fg_block.y();
 
-	// get the shared parameter
+	// get the shared parameter, if this row is connected to one
 	// only the shared parameters V_reset, V_stdf, V_fac and V_dtc are used
-	try
+	if (auto const shared_param = HICANN::findSharedParameter(fg_block,row))
 	{
-		HICANN::shared_parameter shared_param_type = HICANN::getSharedParameter(fg_block,row);
+		HICANN::shared_parameter shared_param_type = *shared_param;
+		ESS::SyndriverParameterHW & shrd_param = hica.syndriver_config[side].synapse_params_hw[vert];
 		// V_stdf
 		if (shared_param_type == HICANN::shared_parameter::V_stdf)
 		{
-			ESS::SyndriverParameterHW & shrd_param = mhal_access->wafer().hicanns[hic_id].syndriver_config[side].synapse_params_hw[vert];
 			shrd_param.V_stdf = fg.getShared();
 		}
 		// V_fac
 		else if (shared_param_type == HICANN::shared_parameter::V_fac)
 		{
-			ESS::SyndriverParameterHW & shrd_param = mhal_access->wafer().hicanns[hic_id].syndriver_config[side].synapse_params_hw[vert];
 			shrd_param.V_fac = fg.getShared();
 		}
 		// V_dtc
 		else if (shared_param_type == HICANN::shared_parameter::V_dtc)
 		{
-			ESS::SyndriverParameterHW & shrd_param = mhal_access->wafer().hicanns[hic_id].syndriver_config[side].synapse_params_hw[vert];
 			shrd_param.V_dtc = fg.getShared();
 		}
 		// V_reset (shared neuron parameter)
@@ -1166,31 +1191,24 @@ HICANN::FGErrorResultQuadRow HAL2ESS::set_fg_row_values(Handle::HICANN & h, halc
 				halco::hicann::v2::NeuronOnQuad nrn_on_quad( halco::common::Enum(fg_block.toEnum()) );
 				halco::hicann::v2::NeuronOnHICANN nrn(quad, nrn_on_quad);
 				size_t addr = nrn.toEnum();
-				auto & nrn_ess  = mhal_access->wafer().hicanns[hic_id].neurons_on_hicann[addr];
-				nrn_ess.V_reset = fg.getShared();
+				hica.neurons_on_hicann[addr].V_reset = fg.getShared();
 			}
 		}
 	}
-	catch (std::out_of_range&)
-	{}
 
-	//get the neuron parameter
-	// try to get the type, if this row is not connected continue
-	try
+	//get the neuron parameter, if this row is connected to one
+	if (auto const nrn_param = HICANN::findNeuronParameter(fg_block,row))
 	{
-		HICANN::neuron_parameter nrn_param_type = HICANN::getNeuronParameter(fg_block,row);
+		HICANN::neuron_parameter nrn_param_type = *nrn_param;
 		// set the neuron parameter
 		for (auto nrn_fg : halco::common::iter_all<halco::hicann::v2::NeuronOnFGBlock>())
 		{
 			halco::hicann::v2::NeuronOnHICANN nrn = nrn_fg.toNeuronOnHICANN(fg_block);
 			size_t nrn_id = nrn.toEnum();
-			auto & nrn_params = mhal_access->wafer().hicanns[hic_id].neurons_on_hicann[nrn_id].neuron_parameters;
 			auto const param = fg.getNeuron(nrn_fg);
-			nrn_params.setParam(nrn_param_type, param);
+			hica.neurons_on_hicann[nrn_id].neuron_parameters.setParam(nrn_param_type, param);
 		}
 	}
-	catch (std::out_of_range&)
-	{}
 
 	// return empty error vectors to indicate that writing was successful
 	return HICANN::FGErrorResultQuadRow{};
@@ -1201,7 +1219,8 @@ HICANN::FGErrorResultQuadRow HAL2ESS::set_fg_row_values(
 		HICANN::FGRowOnFGBlock4 rows,
 		HICANN::FGRow4 data,
 		bool const writeDown,
-		bool const blocking)
+		bool const blocking,
+		bool const)
 {
 	for (auto block : halco::common::iter_all<halco::hicann::v2::FGBlockOnHICANN>())
 	{
@@ -1214,7 +1233,7 @@ HICANN::FGErrorResultQuadRow HAL2ESS::set_fg_row_values(
 }
 
 //sets the fg values for a full FGControl
-void HAL2ESS::set_fg_values(Handle::HICANN const& h, HICANN::FGControl const& fg)
+void HAL2ESS::set_fg_values(Handle::HICANN const& h, HICANN::FGControl const& fg, bool const)
 {
 	for (size_t i = 0; i < fg.size(); i++)
 	{
@@ -1223,6 +1242,13 @@ void HAL2ESS::set_fg_values(Handle::HICANN const& h, HICANN::FGControl const& fg
 	}
 }
 
+void HAL2ESS::set_fg_values(std::vector<boost::shared_ptr<Handle::HICANN> > handles, std::vector<HICANN::FGControl> const& fgs)
+{
+	for (auto v: pythonic::zip(handles, fgs)) {
+		set_fg_values(*(v.first), v.second);
+	}
+}
+
 //gets the analog fg_values, not possible that way in real Hardware
 //not a fuction of HICANNBackend any,ore, but still here for tests
 HICANN::FGBlock HAL2ESS::get_fg_values(Handle::HICANN const& h, halco::hicann::v2::FGBlockOnHICANN const& addr)
@@ -1533,9 +1559,11 @@ HICANN::VerticalRepeater HAL2ESS::get_repeater(Handle::HICANN const& h, halco::h
 		}
 	}
 	//get the repeater config from the ESS and assert equality
-	HICANN::VerticalRepeater returnval_ESS = get_repeater_ESS(h, r);
-	(void) returnval_ESS;
-	assert(returnval == returnval_ESS);
+	if (mconsistency_check) {
+		HICANN::VerticalRepeater returnval_ESS = get_repeater_ESS(h, r);
+		(void) returnval_ESS;
+		assert(returnval == returnval_ESS);
+	}
 	return returnval;
 }
 
@@ -1663,9 +1691,11 @@ HICANN::HorizontalRepeater HAL2ESS::get_repeater(
 			returnval.setOutput(halco::common::left);
 	}
 	//get the repeater from the ESS and assert equality
-	HICANN::HorizontalRepeater returnval_ESS = get_repeater_ESS(h,r);
-	(void) returnval_ESS;
-	assert(returnval == returnval_ESS);
+	if (mconsistency_check) {
+		HICANN::HorizontalRepeater returnval_ESS = get_repeater_ESS(h,r);
+		(void) returnval_ESS;
+		assert(returnval == returnval_ESS);
+	}
 	return returnval;
 }
 
@@ -1988,15 +2018,17 @@ HICANN::BackgroundGeneratorArray HAL2ESS::get_background_generator(Handle::HICAN
 		returnval[i].seed(seeed);
 	}
 	//get the BGarray from the ESS and assert equality
-	HICANN::BackgroundGeneratorArray returnval_ESS = get_background_generator_ESS(h);
-	(void) returnval_ESS;
-	//seed is not gettable from ess and the enable bit is not read out correctly yet TODO...
-	for(size_t i = 0; i < returnval.size(); ++i)
-	{
-		//assert(returnval[i].enable() == returnval_ESS[i].enable());
-		assert(returnval[i].random() == returnval_ESS[i].random());
-		assert(returnval[i].address() == returnval_ESS[i].address());
-		assert(returnval[i].period() == returnval_ESS[i].period());
+	if (mconsistency_check) {
+		HICANN::BackgroundGeneratorArray returnval_ESS = get_background_generator_ESS(h);
+		(void) returnval_ESS;
+		//seed is not gettable from ess and the enable bit is not read out correctly yet TODO...
+		for(size_t i = 0; i < returnval.size(); ++i)
+		{
+			//assert(returnval[i].enable() == returnval_ESS[i].enable());
+			assert(returnval[i].random() == returnval_ESS[i].random());
+			assert(returnval[i].address() == returnval_ESS[i].address());
+			assert(returnval[i].period() == returnval_ESS[i].period());
+		}
 	}
 
 	return returnval;
@@ -2324,6 +2356,95 @@ ADC::USBSerial HAL2ESS::get_board_id(Handle::ADC & h)
 //************************
 //end of backend functions
 //************************
+
+//************************
+//Bulk access functions
+//************************
+
+void HAL2ESS::set_weights(Handle::HICANN const& h, weights_type const& weights)
+{
+	auto& hica = mhal_access->wafer().hicanns[static_cast<size_t>(h.coordinate().toHICANNOnWafer().toEnum())];
+	size_t nonzero = 0;
+	for (auto row : halco::common::iter_all<halco::hicann::v2::SynapseRowOnHICANN>())
+		nonzero += write_weights_row(hica, row, weights[row]);
+	LOG4CXX_DEBUG(_logger, "set_weights: " << nonzero << " non-zero weights set");
+}
+
+HAL2ESS::weights_type HAL2ESS::get_weights(Handle::HICANN const& h)
+{
+	auto& hica = mhal_access->wafer().hicanns[static_cast<size_t>(h.coordinate().toHICANNOnWafer().toEnum())];
+	weights_type returnval;
+	for (auto row : halco::common::iter_all<halco::hicann::v2::SynapseRowOnHICANN>())
+		returnval[row] = read_weights_row(hica, row);
+	if (mconsistency_check) {
+		for (auto row : halco::common::iter_all<halco::hicann::v2::SynapseRowOnHICANN>())
+			assert(returnval[row] == get_weights_row_ESS(h, row));
+	}
+	return returnval;
+}
+
+void HAL2ESS::set_decoders(Handle::HICANN const& h, decoders_type const& decoders)
+{
+	auto& hica = mhal_access->wafer().hicanns[static_cast<size_t>(h.coordinate().toHICANNOnWafer().toEnum())];
+	size_t non_blocking = 0;
+	for (auto drv : halco::common::iter_all<halco::hicann::v2::SynapseDriverOnHICANN>())
+		non_blocking += write_decoder_double_row(hica, drv, decoders[drv]);
+	LOG4CXX_DEBUG(_logger, "set_decoders: " << non_blocking << " non-blocking decoders set");
+}
+
+HAL2ESS::decoders_type HAL2ESS::get_decoders(Handle::HICANN const& h)
+{
+	auto& hica = mhal_access->wafer().hicanns[static_cast<size_t>(h.coordinate().toHICANNOnWafer().toEnum())];
+	decoders_type returnval;
+	for (auto drv : halco::common::iter_all<halco::hicann::v2::SynapseDriverOnHICANN>())
+		returnval[drv] = read_decoder_double_row(hica, drv);
+	if (mconsistency_check) {
+		for (auto drv : halco::common::iter_all<halco::hicann::v2::SynapseDriverOnHICANN>())
+			assert(returnval[drv] == get_decoder_double_row_ESS(h, drv));
+	}
+	return returnval;
+}
+
+void HAL2ESS::set_crossbar(Handle::HICANN const& h, HICANN::Crossbar const& crossbar)
+{
+	auto& hica = mhal_access->wafer().hicanns[static_cast<size_t>(h.coordinate().toHICANNOnWafer().toEnum())];
+	for (auto hline : halco::common::iter_all<halco::hicann::v2::HLineOnHICANN>())
+		for (halco::common::Side side : {halco::common::left, halco::common::right})
+			write_crossbar_row(hica, hline, side, crossbar.get_row(hline, side));
+}
+
+HICANN::Crossbar HAL2ESS::get_crossbar(Handle::HICANN const& h)
+{
+	auto& hica = mhal_access->wafer().hicanns[static_cast<size_t>(h.coordinate().toHICANNOnWafer().toEnum())];
+	HICANN::Crossbar returnval;
+	for (auto hline : halco::common::iter_all<halco::hicann::v2::HLineOnHICANN>()) {
+		for (halco::common::Side side : {halco::common::left, halco::common::right}) {
+			HICANN::CrossbarRow const row = read_crossbar_row(hica, hline, side);
+			assert(!mconsistency_check || row == get_crossbar_switch_row_ESS(h, hline, side));
+			returnval.set_row(hline, side, row);
+		}
+	}
+	return returnval;
+}
+
+void HAL2ESS::set_syndriver_switches(Handle::HICANN const& h, HICANN::SynapseSwitch const& switches)
+{
+	auto& hica = mhal_access->wafer().hicanns[static_cast<size_t>(h.coordinate().toHICANNOnWafer().toEnum())];
+	for (auto row : halco::common::iter_all<halco::hicann::v2::SynapseSwitchRowOnHICANN>())
+		write_synswitch_row(hica, row, switches.get_row(row));
+}
+
+HICANN::SynapseSwitch HAL2ESS::get_syndriver_switches(Handle::HICANN const& h)
+{
+	auto& hica = mhal_access->wafer().hicanns[static_cast<size_t>(h.coordinate().toHICANNOnWafer().toEnum())];
+	HICANN::SynapseSwitch returnval;
+	for (auto row : halco::common::iter_all<halco::hicann::v2::SynapseSwitchRowOnHICANN>()) {
+		HICANN::SynapseSwitchRow const switches = read_synswitch_row(hica, row);
+		assert(!mconsistency_check || switches == get_syndriver_switch_row_ESS(h, row));
+		returnval.set_row(row, switches);
+	}
+	return returnval;
+}
     
 //**********************
 //Public Debug Functions
@@ -15,6 +15,8 @@
 #include "hal/FPGAContainer.h"
 #include "halco/hicann/v2/fwd.h"
 #include "hal/HICANNContainer.h"
+#include "hal/HICANN/Crossbar.h"
+#include "hal/HICANN/SynapseSwitch.h"
 #include "hal/HICANN/FGConfig.h"
 #include "hal/HICANN/FGBlock.h"
 #include "hal/HICANN/FGErrorResult.h"
@@ -111,6 +113,11 @@ public:
 	//runs the simulation by calling the corresponding function of mvirtual_hw
 	void run_sim(long duration_in_ns);
 
+	/// Getters, including the bulk getters, compare the HAL2ESS datastructure with the
+	/// simulator state and assert equality.  The comparison is enabled by default,
+	/// disabling it halves the work of getters for large setups.
+	void enable_consistency_check(bool const enable);
+
 //Functions of HICANNBackend
 	//Crossbars and Switches
 	void set_crossbar_switch_row(Handle::HICANN const& h, halco::hicann::v2::HLineOnHICANN y_, halco::common::Side s, HICANN::CrossbarRow const & switches);
@@ -132,6 +139,7 @@ public:
 	                        HICANN::SynapseController const&,
 	                        halco::hicann::v2::SynapseDriverOnHICANN const& s,
 	                        HICANN::SynapseDriver const& drv_row);
+	void set_synapse_driver(std::vector<boost::shared_ptr<Handle::HICANN> > handles, std::vector<HICANN::SynapseController> const&, halco::hicann::v2::SynapseDriverOnHICANN const& s, std::vector<HICANN::SynapseDriver> const& data);
 	HICANN::SynapseDriver get_synapse_driver(Handle::HICANN const& h,
 	                                         HICANN::SynapseController const&,
 	                                         halco::hicann::v2::SynapseDriverOnHICANN const& s);
@@ -147,17 +155,19 @@ public:
 	//Floating Gates
 	HICANN::FGErrorResultRow wait_fg(Handle::HICANN &, halco::hicann::v2::FGBlockOnHICANN const &);
 	HICANN::FGErrorResultQuadRow wait_fg(Handle::HICANN &);
-	void set_fg_values(Handle::HICANN const& h, halco::hicann::v2::FGBlockOnHICANN const& b, HICANN::FGBlock const& fg);
-	void set_fg_values(Handle::HICANN const& h, HICANN::FGControl const& fg);
-	HICANN::FGErrorResultQuadRow set_fg_row_values(Handle::HICANN & h, halco::hicann::v2::FGRowOnFGBlock row, HICANN::FGControl const& fg, bool const, bool const);
+	void set_fg_values(Handle::HICANN const& h, halco::hicann::v2::FGBlockOnHICANN const& b, HICANN::FGBlock const& fg, bool const double_buffered = false);
+	void set_fg_values(Handle::HICANN const& h, HICANN::FGControl const& fg, bool const double_buffered = false);
+	void set_fg_values(std::vector<boost::shared_ptr<Handle::HICANN> > handles, std::vector<HICANN::FGControl> const& fgs);
+	HICANN::FGErrorResultQuadRow set_fg_row_values(Handle::HICANN & h, halco::hicann::v2::FGRowOnFGBlock row, HICANN::FGControl const& fg, bool const, bool const, bool const = false);
 	HICANN::FGErrorResultQuadRow set_fg_row_values(
 		Handle::HICANN & h,
 		HICANN::FGRowOnFGBlock4 rows,
 		HICANN::FGRow4 data,
 		bool const writeDown,
-		bool const blocking = true);
+		bool const blocking = true,
+		bool const double_buffered = false);
 	HICANN::FGErrorResultQuadRow set_fg_row_values(Handle::HICANN & h, halco::hicann::v2::FGBlockOnHICANN block, halco::hicann::v2::FGRowOnFGBlock row,
-	HICANN::FGRow const& fg, bool const writeDown, bool const blocking = true);
+	HICANN::FGRow const& fg, bool const writeDown, bool const blocking = true, bool const double_buffered = false);
 	void set_fg_ram_values(
 	    Handle::HICANN const& /*h*/,
 	    halco::hicann::v2::FGBlockOnHICANN const& /*b*/,
@@ -195,6 +205,7 @@ public:
 
 	//ESS_DUMMY implemented, these functions are necessary for controlling test_events, as far as i know this functionality is not represented in the ESS
 	void set_repeater_block(Handle::HICANN const&, halco::hicann::v2::RepeaterBlockOnHICANN, HICANN::RepeaterBlock const&){ESS_DUMMY();}
+	void set_repeater_block(std::vector<boost::shared_ptr<Handle::HICANN> >, halco::hicann::v2::RepeaterBlockOnHICANN, std::vector<HICANN::RepeaterBlock> const&){ESS_DUMMY();}
 	HICANN::RepeaterBlock get_repeater_block(Handle::HICANN const&, halco::hicann::v2::RepeaterBlockOnHICANN){ESS_DUMMY();return HICANN::RepeaterBlock{};}
 
 	// SynapseController
@@ -388,6 +399,27 @@ public:
 	void set_L1_voltages(Handle::HICANN &, float, float){ESS_DUMMY();}
 
 // Public non-halbe funcions
+	// bulk access to whole synapse arrays and switch matrices of a HICANN, equivalent to
+	// calling the row-wise functions for all rows but resolving the HICANN only once
+	// (FG blocks: use set_fg_values(h, FGControl))
+	typedef halco::common::typed_array<HICANN::WeightRow, halco::hicann::v2::SynapseRowOnHICANN>
+		weights_type;
+	typedef halco::common::
+		typed_array<HICANN::DecoderDoubleRow, halco::hicann::v2::SynapseDriverOnHICANN>
+			decoders_type;
+
+	void set_weights(Handle::HICANN const& h, weights_type const& weights);
+	weights_type get_weights(Handle::HICANN const& h);
+
+	void set_decoders(Handle::HICANN const& h, decoders_type const& decoders);
+	decoders_type get_decoders(Handle::HICANN const& h);
+
+	void set_crossbar(Handle::HICANN const& h, HICANN::Crossbar const& crossbar);
+	HICANN::Crossbar get_crossbar(Handle::HICANN const& h);
+
+	void set_syndriver_switches(Handle::HICANN const& h, HICANN::SynapseSwitch const& switches);
+	HICANN::SynapseSwitch get_syndriver_switches(Handle::HICANN const& h);
+
     // retunrs the adex-model-parameter of nrn
     PyNNParameters::EIF_cond_exp_isfa_ista get_bio_parameter(Handle::HICANN const& h, halco::hicann::v2::NeuronOnHICANN const& nrn ) const;
     PyNNParameters::EIF_cond_exp_isfa_ista get_technical_parameter(Handle::HICANN const& h, halco::hicann::v2::NeuronOnHICANN const& nrn ) const;
@@ -431,6 +463,9 @@ private:
     std::unique_ptr<HALaccess>				mhal_access;
 	std::unique_ptr<Stage2VirtualHardware>	mvirtual_hw;
 	std::string                             mpulse_statistics_file;  // file to which summary of lost event logger shall be written
+	bool                                    mconsistency_check; ///< compare with simulator state in getters
+	struct PCBTopology;
+	std::unique_ptr<PCBTopology>            mpcb_topology; ///< coordinate dependent part of the PCB config, computed once (cf. initialize_sim)
 	// The number of FPGAs is variable: 12 for Virtex and 48 for Kintex systems
 	// PulseContainer for recording FPGAEvents
 	std::vector<FPGA::PulseEventContainer> mFPGAdata;
@@ -354,6 +354,38 @@ TEST_F(ESSTest, Test_Synswitches_Config)
 	EXPECT_EQ(pattern1r, pattern2r);
 }
 
+//test for the bulk access to synapse arrays and switch matrices
+TEST_F(ESSTest, Test_Bulk_Config)
+{
+	HICANN::init(h);
+	HAL2ESS& ess = h.ess();
+
+	std::unique_ptr<HAL2ESS::weights_type> weights(new HAL2ESS::weights_type());
+	for (auto row : halco::common::iter_all<halco::hicann::v2::SynapseRowOnHICANN>())
+		for (size_t col = 0; col < (*weights)[row].size(); ++col)
+			(*weights)[row][col] = HICANN::SynapseWeight((row.toEnum() + col) % 16);
+
+	HICANN::SynapseSwitch switches;
+	for (size_t i = 0; i < 224; ++i) {
+		HICANN::SynapseSwitchRow row{};
+		row[i % 16] = true;
+		switches.set_row(halco::hicann::v2::SynapseSwitchRowOnHICANN(halco::common::Y(i), halco::common::left), row);
+	}
+
+	ess.set_weights(h, *weights);
+	ess.set_syndriver_switches(h, switches);
+	//write data to Ess
+	fpga.initializeESS();
+
+	ess.enable_consistency_check(false);
+	EXPECT_EQ(*weights, ess.get_weights(h));
+	EXPECT_EQ(switches, ess.get_syndriver_switches(h));
+
+	ess.enable_consistency_check(true);
+	EXPECT_EQ(*weights, ess.get_weights(h));
+	EXPECT_EQ(switches, ess.get_syndriver_switches(h));
+}
+
 //test for the neuron config
 //currently only capacitance used in the Ess
 //data only from HAL2ESS data structure
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <limits>
 #include <stdexcept>
 #include <random>
 
@@ -274,6 +275,193 @@ bool PulseEventContainer::operator!=(PulseEventContainer const& other) const {
 	return !((*this) == other);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// PulseEventColumns
+
+PulseEventColumns::PulseEventColumns(bool const delta_encoded) :
+	m_delta_encoding_requested(delta_encoded),
+	m_delta_encoded(delta_encoded),
+	m_times(),
+	m_time_deltas(),
+	m_first_time(0),
+	m_last_time(0),
+	m_labels()
+{
+}
+
+PulseEventColumns::PulseEventColumns(PulseEventContainer const& events, bool const delta_encoded) :
+	PulseEventColumns(delta_encoded)
+{
+	reserve(events.size());
+	for (auto const& event : events.data()) {
+		append(event.getTime(), event.getLabel());
+	}
+}
+
+void PulseEventColumns::append(spiketime_t const time, label_t const label)
+{
+	if (!m_labels.empty() && time < m_last_time) {
+		throw std::invalid_argument("can not append earlier event to sorted pulse event container");
+	}
+
+	if (m_delta_encoded) {
+		if (m_labels.empty()) {
+			m_first_time = time;
+		}
+		spiketime_t const delta = m_labels.empty() ? 0 : time - m_last_time;
+		if (delta > std::numeric_limits<time_delta_t>::max()) {
+			decode_deltas();
+			m_times.push_back(time);
+		} else {
+			m_time_deltas.push_back(static_cast<time_delta_t>(delta));
+		}
+	} else {
+		m_times.push_back(time);
+	}
+	m_labels.push_back(label);
+	m_last_time = time;
+}
+
+void PulseEventColumns::reserve(size_t const size)
+{
+	if (m_delta_encoded) {
+		m_time_deltas.reserve(size);
+	} else {
+		m_times.reserve(size);
+	}
+	m_labels.reserve(size);
+}
+
+void PulseEventColumns::clear()
+{
+	m_delta_encoded = m_delta_encoding_requested;
+	m_times.clear();
+	m_time_deltas.clear();
+	m_first_time = 0;
+	m_last_time = 0;
+	m_labels.clear();
+}
+
+size_t PulseEventColumns::size() const
+{
+	return m_labels.size();
+}
+
+bool PulseEventColumns::empty() const
+{
+	return m_labels.empty();
+}
+
+bool PulseEventColumns::delta_encoded() const
+{
+	return m_delta_encoded;
+}
+
+std::vector<PulseEventColumns::spiketime_t> PulseEventColumns::times() const
+{
+	if (!m_delta_encoded) {
+		return m_times;
+	}
+	std::vector<spiketime_t> ret;
+	ret.reserve(m_time_deltas.size());
+	spiketime_t time = m_first_time;
+	for (auto const delta : m_time_deltas) {
+		time += delta;
+		ret.push_back(time);
+	}
+	return ret;
+}
+
+std::vector<PulseEventColumns::label_t> const& PulseEventColumns::labels() const
+{
+	return m_labels;
+}
+
+PulseEventContainer::container_type PulseEventColumns::events() const
+{
+	std::vector<spiketime_t> const times = this->times();
+	PulseEventContainer::container_type ret;
+	ret.reserve(size());
+	for (size_t ii = 0; ii < size(); ++ii) {
+		ret.emplace_back(PulseAddress(m_labels[ii]), times[ii]);
+	}
+	return ret;
+}
+
+PulseEventContainer PulseEventColumns::to_container() const
+{
+	return PulseEventContainer(events());
+}
+
+PulseEventColumns PulseEventColumns::slice(spiketime_t const begin, spiketime_t const end) const
+{
+	PulseEventColumns ret(m_delta_encoded);
+	if (!m_delta_encoded) {
+		auto const first = std::lower_bound(m_times.begin(), m_times.end(), begin);
+		auto const last = std::lower_bound(first, m_times.end(), end);
+		size_t const offset = first - m_times.begin();
+		ret.reserve(last - first);
+		for (auto it = first; it != last; ++it) {
+			ret.append(*it, m_labels[offset + (it - first)]);
+		}
+		return ret;
+	}
+
+	spiketime_t time = m_first_time;
+	for (size_t ii = 0; ii < m_time_deltas.size(); ++ii) {
+		time += m_time_deltas[ii];
+		if (time >= end) {
+			break;
+		}
+		if (time >= begin) {
+			ret.append(time, m_labels[ii]);
+		}
+	}
+	return ret;
+}
+
+PulseEventColumns PulseEventColumns::merge(PulseEventColumns const& a, PulseEventColumns const& b)
+{
+	std::vector<spiketime_t> const a_times = a.times();
+	std::vector<spiketime_t> const b_times = b.times();
+
+	PulseEventColumns ret(a.m_delta_encoded);
+	ret.reserve(a.size() + b.size());
+	size_t ia = 0, ib = 0;
+	while (ia < a.size() && ib < b.size()) {
+		if (b_times[ib] < a_times[ia]) {
+			ret.append(b_times[ib], b.m_labels[ib]);
+			++ib;
+		} else {
+			ret.append(a_times[ia], a.m_labels[ia]);
+			++ia;
+		}
+	}
+	for (; ia < a.size(); ++ia) {
+		ret.append(a_times[ia], a.m_labels[ia]);
+	}
+	for (; ib < b.size(); ++ib) {
+		ret.append(b_times[ib], b.m_labels[ib]);
+	}
+	return ret;
+}
+
+void PulseEventColumns::decode_deltas()
+{
+	m_times = times();
+	m_time_deltas.clear();
+	m_time_deltas.shrink_to_fit();
+	m_delta_encoded = false;
+}
+
+bool PulseEventColumns::operator==(PulseEventColumns const& other) const {
+	return m_labels == other.m_labels && times() == other.times();
+}
+
+bool PulseEventColumns::operator!=(PulseEventColumns const& other) const {
+	return !((*this) == other);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // SpinnakerEventContainer
 
@@ -471,6 +471,91 @@ private:
 	}
 };
 
+/**
+ * @brief Pulse events stored as separate time and label columns, sorted by time.
+ *
+ * Compared to PulseEventContainer (16 bytes per event due to padding), an event
+ * takes 10 bytes or, with delta-encoded times, 6 bytes.  In delta encoding the
+ * time of each event is stored relative to its predecessor, operations decode
+ * the times on the fly.  If a time difference does not fit into a delta, the
+ * container falls back to absolute times.
+ */
+struct PulseEventColumns
+{
+public:
+	typedef PulseEvent::spiketime_t spiketime_t;
+	typedef PulseAddress::label_t label_t;
+	typedef uint32_t time_delta_t;
+
+	explicit PulseEventColumns(bool delta_encoded = false);
+	explicit PulseEventColumns(PulseEventContainer const& events, bool delta_encoded = false);
+
+	/**
+	 * @brief Append pulse event to container.
+	 * @throw std::invalid_argument If container invariant would not be preserved.
+	 */
+	void append(spiketime_t time, label_t label);
+
+	void reserve(size_t size);
+	/// Removes all pulse events and restores the encoding requested on construction.
+	void clear();
+	size_t size() const;
+	bool empty() const;
+
+	bool delta_encoded() const;
+
+	/// Returns the (decoded) times of all pulse events.
+	std::vector<spiketime_t> times() const;
+	std::vector<label_t> const& labels() const;
+
+	PulseEventContainer::container_type events() const;
+	PulseEventContainer to_container() const;
+
+	/// Returns all pulse events with begin <= time < end.
+	PulseEventColumns slice(spiketime_t begin, spiketime_t end) const;
+
+	/**
+	 * @brief Merges two containers, preserving the container invariant.
+	 *
+	 * Events of the same time are ordered a before b, the result uses the
+	 * encoding of a.
+	 */
+	static PulseEventColumns merge(PulseEventColumns const& a, PulseEventColumns const& b);
+
+	bool operator==(const PulseEventColumns& other) const;
+	bool operator!=(const PulseEventColumns& other) const;
+
+private:
+	void decode_deltas();
+
+	// encoding requested on construction, m_delta_encoded is reset after a fallback
+	bool m_delta_encoding_requested;
+	bool m_delta_encoded;
+	// absolute times, used without delta encoding
+	std::vector<spiketime_t> m_times;
+	// times relative to preceding event (first event: relative to m_first_time)
+	std::vector<time_delta_t> m_time_deltas;
+	spiketime_t m_first_time;
+	spiketime_t m_last_time;
+	std::vector<label_t> m_labels;
+
+	friend class boost::serialization::access;
+	template<typename Archiver>
+	void serialize(Archiver& ar, const unsigned int)
+	{
+		using namespace boost::serialization;
+		// clang-format off
+		ar & make_nvp("delta_encoding_requested", m_delta_encoding_requested)
+		   & make_nvp("delta_encoded", m_delta_encoded)
+		   & make_nvp("times", m_times)
+		   & make_nvp("time_deltas", m_time_deltas)
+		   & make_nvp("first_time", m_first_time)
+		   & make_nvp("last_time", m_last_time)
+		   & make_nvp("labels", m_labels);
+		// clang-format on
+	}
+};
+
 struct SpinnakerEventContainer {
 	// TODO
 	bool operator==(const SpinnakerEventContainer & other) const;
@@ -21,10 +21,15 @@ public:
 	PYPP_CONSTEXPR Crossbar() {}
 
 	static bool exists(x_type x, y_type y);
+	/// exists() on the enum values of the coordinates, usable at compile time
+	static PYPP_CONSTEXPR bool exists_enum(size_t x, size_t y)
+	{
+		return x < 128 ? (31 - y / 2) == x % 32 : y / 2 == x % 32;
+	}
 	std::string check_exclusiveness(size_t max_switches_per_row,
 	                                size_t max_switches_per_column) const;
 
-	CrossbarRow const&
+	CrossbarRow
 	get_row(halco::hicann::v2::HLineOnHICANN y, halco::common::Side s) const;
 	void set_row(halco::hicann::v2::HLineOnHICANN y, halco::common::Side s, CrossbarRow const&);
 
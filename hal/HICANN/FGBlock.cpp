@@ -21,24 +21,23 @@ size_t const FGBlock::fg_blocks;
 size_t const FGBlock::fg_lines;
 size_t const FGBlock::fg_columns;
 
-FGBlock::shared_lut_t const
-FGBlock::shared_lut_left = {{
+namespace {
+
+constexpr FGBlock::shared_lut_t shared_lut_left_rows = {{
 	0, 1, 2, 3, not_connected,
 	4, 5, 6, 7, 8, 9, 10, 11,
 	12, not_connected, 13, 14,
 	15, 16, 17, 19, 21, 23
 }};
 
-FGBlock::shared_lut_t const
-FGBlock::shared_lut_right = {{
+constexpr FGBlock::shared_lut_t shared_lut_right_rows = {{
 	0, 1, 2, not_connected, 3,
 	4, 5, 6, 7, 8, 9, 10, 11,
 	not_connected, 12, 13, 14,
 	15, 16, 17, 19, 21, 23
 }};
 
-FGBlock::neuron_lut_t const
-FGBlock::neuron_lut_left = {{
+constexpr FGBlock::neuron_lut_t neuron_lut_left_rows = {{
 	6, 18, 16, 1, 3, 17, 7, 11, 9, 21, 19,
 	13, 15, 23, 5, 20, 8, 10, 14, 22, 12
 // #ifdef HICANNv4
@@ -46,8 +45,7 @@ FGBlock::neuron_lut_left = {{
 // #endif
 }};
 
-FGBlock::neuron_lut_t const
-FGBlock::neuron_lut_right = {{
+constexpr FGBlock::neuron_lut_t neuron_lut_right_rows = {{
 	16, 2, 0, 15, 1, 3, 19, 21, 11, 7, 5,
 	9, 23, 13, 17, 4, 10, 8, 12, 6, 14
 // #ifdef HICANNv4
@@ -55,6 +53,38 @@ FGBlock::neuron_lut_right = {{
 // #endif
 }};
 
+// parameter index of each row or not_connected
+typedef std::array<int, FGBlock::fg_lines> row_lut_t;
+
+template <size_t N>
+constexpr row_lut_t invert(std::array<int, N> const& lut)
+{
+	row_lut_t rows{};
+	for (size_t row = 0; row < rows.size(); ++row)
+		rows[row] = not_connected;
+	for (size_t param = 0; param < N; ++param)
+		if (lut[param] != not_connected)
+			rows[lut[param]] = static_cast<int>(param);
+	return rows;
+}
+
+constexpr row_lut_t shared_row_lut_left = invert(shared_lut_left_rows);
+constexpr row_lut_t shared_row_lut_right = invert(shared_lut_right_rows);
+constexpr row_lut_t neuron_row_lut_left = invert(neuron_lut_left_rows);
+constexpr row_lut_t neuron_row_lut_right = invert(neuron_lut_right_rows);
+
+static_assert(shared_row_lut_left[3] == V_bout, "V_bout is on row 3 of left blocks");
+static_assert(shared_row_lut_right[3] == V_bexp, "V_bexp is on row 3 of right blocks");
+static_assert(shared_row_lut_left[18] == not_connected, "row 18 of left blocks is not shared");
+static_assert(neuron_row_lut_right[22] == not_connected, "row 22 of right blocks is shared");
+
+} // namespace
+
+FGBlock::shared_lut_t const FGBlock::shared_lut_left = shared_lut_left_rows;
+FGBlock::shared_lut_t const FGBlock::shared_lut_right = shared_lut_right_rows;
+FGBlock::neuron_lut_t const FGBlock::neuron_lut_left = neuron_lut_left_rows;
+FGBlock::neuron_lut_t const FGBlock::neuron_lut_right = neuron_lut_right_rows;
+
 std::array<std::pair<shared_parameter, FGBlock::value_type>,
 	shared_parameter::__last_shared> const
 FGBlock::shared_default = {{
@@ -116,26 +146,42 @@ FGBlock::neuron_default = {{
 // #endif
 }};
 
+boost::optional<neuron_parameter>
+findNeuronParameter(halco::hicann::v2::FGBlockOnHICANN const& b,
+                    halco::hicann::v2::FGRowOnFGBlock const& r)
+{
+	int const p = (FGBlock::is_left(b) ? neuron_row_lut_left : neuron_row_lut_right)[r.value()];
+	if (p == not_connected)
+		return boost::none;
+	return static_cast<neuron_parameter>(p);
+}
+
+boost::optional<shared_parameter>
+findSharedParameter(halco::hicann::v2::FGBlockOnHICANN const& b,
+                    halco::hicann::v2::FGRowOnFGBlock const& r)
+{
+	int const p = (FGBlock::is_left(b) ? shared_row_lut_left : shared_row_lut_right)[r.value()];
+	if (p == not_connected)
+		return boost::none;
+	return static_cast<shared_parameter>(p);
+}
+
 neuron_parameter getNeuronParameter(halco::hicann::v2::FGBlockOnHICANN const& b,
 		                            halco::hicann::v2::FGRowOnFGBlock const & r)
 {
-	auto const & lut = FGBlock::getNeuronLut(b);
-	auto it = std::find(lut.begin(), lut.end(), r.value());
-	if (it == lut.end())
+	auto const p = findNeuronParameter(b, r);
+	if (!p)
 		throw std::out_of_range("Not connected");
-	else
-		return static_cast<neuron_parameter>(std::distance(lut.begin(), it));
+	return *p;
 }
 
 shared_parameter getSharedParameter(halco::hicann::v2::FGBlockOnHICANN const& b,
 		                            halco::hicann::v2::FGRowOnFGBlock const & r)
 {
-	auto const & lut = FGBlock::getSharedLut(b);
-	auto it = std::find(lut.begin(), lut.end(), r.value());
-	if (it == lut.end())
+	auto const p = findSharedParameter(b, r);
+	if (!p)
 		throw std::out_of_range("Not connected");
-	else
-		return static_cast<shared_parameter>(std::distance(lut.begin(), it));
+	return *p;
 }
 
 bool isCurrentParameter(neuron_parameter p)
@@ -299,11 +345,9 @@ bool isL1Parameter(shared_parameter p)
 
 bool isPotentialL1Row(halco::hicann::v2::FGRowOnFGBlock const& row) {
 	for (auto block : halco::common::iter_all<halco::hicann::v2::FGBlockOnHICANN>()) {
-		try {
-			if (isL1Parameter(getSharedParameter(block, row))) {
-				return true;
-			}
-		} catch (std::out_of_range const&) {
+		auto const p = findSharedParameter(block, row);
+		if (p && isL1Parameter(*p)) {
+			return true;
 		}
 	}
 	return false;
@@ -311,11 +355,9 @@ bool isPotentialL1Row(halco::hicann::v2::FGRowOnFGBlock const& row) {
 
 bool isPotentialFGRow(halco::hicann::v2::FGRowOnFGBlock const& row) {
 	for (auto block : halco::common::iter_all<halco::hicann::v2::FGBlockOnHICANN>()) {
-		try {
-			if (isFGParameter(getSharedParameter(block, row))) {
-				return true;
-			}
-		} catch (std::out_of_range const&) {
+		auto const p = findSharedParameter(block, row);
+		if (p && isFGParameter(*p)) {
+			return true;
 		}
 	}
 	return false;
@@ -352,7 +394,9 @@ void FGBlock::setShared(
 	shared_parameter param,
 	value_type const& val)
 {
-	mShared.at(getSharedLut(b).at(param)) = val;
+	size_t const row = getSharedLut(b).at(param);
+	mShared.at(row) = val;
+	FGRow::format(mFormatted[row], 0, val);
 }
 
 FGBlock::value_type FGBlock::getSharedRaw(size_t idx) const
@@ -389,6 +433,16 @@ void FGBlock::setRaw(halco::hicann::v2::FGCellOnFGBlock cell, value_type val)
 		mShared.at(cell.y()) = val;
 	else
 		mNeuron.at(cell.x() - 1).at(cell.y()) = val;
+	FGRow::format(mFormatted[cell.y()], cell.x(), val);
+}
+
+void FGBlock::updateFormatted()
+{
+	for (size_t row = 0; row < fg_lines; ++row) {
+		mFormatted[row].fill(0);
+		for (size_t column = 0; column < fg_columns; ++column)
+			FGRow::format(mFormatted[row], column, getRaw(row, column));
+	}
 }
 
 FGBlock::value_type FGBlock::getNeuron(
@@ -481,19 +535,20 @@ FGBlock::set_formatter(
 	FGBlockOnHICANN const& /* b */,
 	rant::integral_range<size_t, 23> const& row) const
 {
-	std::array<std::bitset<20>, 65> r;
-
 	// TODO: make sure its address 0 on left as well as right side
-	// set shared parameter
-	r[0] = getSharedRaw(row);
-
-	// set neuron parameter
-	for (size_t nrn=0; nrn<128; ++nrn)
-		r[(nrn+1)/2] |= (getNeuronRaw(nrn, row) << (nrn%2 ? 0 : 10));
-
+	auto const& words = getFormattedRow(row);
+	std::array<std::bitset<20>, 65> r;
+	for (size_t ii = 0; ii < r.size(); ++ii)
+		r[ii] = words[ii];
 	return r;
 }
 
+FGRow::formatted_row_t const&
+FGBlock::getFormattedRow(rant::integral_range<size_t, 23> const& row) const
+{
+	return mFormatted[row];
+}
+
 FGRow FGBlock::getFGRow(FGRowOnFGBlock row) const
 {
 	FGRow fg_row;
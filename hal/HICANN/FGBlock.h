@@ -1,5 +1,9 @@
 #pragma once
 
+#ifndef PYPLUSPLUS
+#include <boost/optional.hpp>
+#endif
+
 #include "hal/test.h"
 #include "halco/hicann/v2/fg.h"
 #include "hal/HICANN/FGRow.h"
@@ -80,6 +84,17 @@ neuron_parameter getNeuronParameter(halco::hicann::v2::FGBlockOnHICANN const& b,
 		                            halco::hicann::v2::FGRowOnFGBlock const & r);
 shared_parameter getSharedParameter(halco::hicann::v2::FGBlockOnHICANN const& b,
 		                            halco::hicann::v2::FGRowOnFGBlock const & r);
+#ifndef PYPLUSPLUS
+/// Non-throwing variants of getNeuronParameter and getSharedParameter based on
+/// precomputed row-to-parameter tables, empty if the row is not connected.
+/// @notice Performance-optimized function has not been exposed to Python.
+boost::optional<neuron_parameter>
+findNeuronParameter(halco::hicann::v2::FGBlockOnHICANN const& b,
+                    halco::hicann::v2::FGRowOnFGBlock const& r);
+boost::optional<shared_parameter>
+findSharedParameter(halco::hicann::v2::FGBlockOnHICANN const& b,
+                    halco::hicann::v2::FGRowOnFGBlock const& r);
+#endif // PYPLUSPLUS
 halco::hicann::v2::FGRowOnFGBlock
 getNeuronRow(halco::hicann::v2::FGBlockOnHICANN const& b, neuron_parameter p);
 halco::hicann::v2::FGRowOnFGBlock
@@ -189,6 +204,11 @@ public:
 	set_formatter(halco::hicann::v2::FGBlockOnHICANN const& b,
 			  rant::integral_range<size_t, 23> const& row) const;
 
+	/// Preformatted FG controller RAM words of a row, kept up to date by all
+	/// setters, i.e. no formatting is needed when programming.
+	FGRow::formatted_row_t const&
+	getFormattedRow(rant::integral_range<size_t, 23> const& row) const;
+
 	typedef std::array<rant::integral_range<value_type, 1023>, fg_lines> fg_t;
 #endif // PYPLUSPLUS
 
@@ -198,6 +218,9 @@ private:
 #ifndef PYPLUSPLUS
 	fg_t mShared;
 	std::array<fg_t, fg_columns-1> mNeuron;
+	std::array<FGRow::formatted_row_t, fg_lines> mFormatted{};
+
+	void updateFormatted();
 #endif
 	halco::hicann::v2::FGBlockOnHICANN mCoordinate;
 
@@ -218,6 +241,8 @@ void FGBlock::serialize(Archiver & ar, unsigned int const)
 	using boost::serialization::make_nvp;
 	ar & make_nvp("shared", mShared)
 	   & make_nvp("neuron", mNeuron);
+	if (Archiver::is_loading::value)
+		updateFormatted();
 }
 #endif
 
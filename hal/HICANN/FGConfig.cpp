@@ -1,4 +1,5 @@
 #include "hal/HICANN/FGConfig.h"
+#include <algorithm>
 #include <ostream>
 #include <bitter/bitter.h>
 
@@ -74,6 +75,15 @@ size_t FGConfig::getMaxVoltageProgrammingTime() const
 	return getMaxProgrammingTime(voltagewritetime.to_ulong());
 }
 
+size_t FGConfig::getMinProgrammingTime() const
+{
+	// first cycle of getMaxProgrammingTime with the shorter write time
+	size_t rt = readtime.to_ulong() + 1;
+	size_t pl = pulselength.to_ulong() + 1;
+	size_t writetime = std::min(voltagewritetime.to_ulong(), currentwritetime.to_ulong());
+	return (writetime * pl + rt * pl * 129) * 4;
+}
+
 size_t FGConfig::getMaxProgrammingTime(size_t writetime) const
 {
 	// See hicann doc
@@ -50,6 +50,10 @@ public:
 	size_t getMaxCurrentProgrammingTime() const;
 	size_t getMaxVoltageProgrammingTime() const;
 
+	/// Returns the time of a single programming cycle of a row of the
+	/// floating gates, i.e. the minimum programming time, in terms of PLL cycles
+	size_t getMinProgrammingTime() const;
+
 private:
 	size_t getMaxProgrammingTime(size_t pulselength) const;
 
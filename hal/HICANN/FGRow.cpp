@@ -9,6 +9,7 @@ size_t const FGRow::fg_columns;
 
 FGRow::FGRow()
 {
+	updateFormatted();
 }
 
 FGRow::~FGRow()
@@ -18,6 +19,7 @@ FGRow::~FGRow()
 void FGRow::setShared(value_type value)
 {
 	mShared = value;
+	format(mFormatted, 0, value);
 }
 
 FGRow::value_type FGRow::getShared() const
@@ -28,6 +30,7 @@ FGRow::value_type FGRow::getShared() const
 void FGRow::setNeuron(halco::hicann::v2::NeuronOnFGBlock neuron, value_type value)
 {
 	mNeuron.at(neuron) = value;
+	format(mFormatted, neuron.value() + 1, value);
 }
 
 FGRow::value_type FGRow::getNeuron(halco::hicann::v2::NeuronOnFGBlock neuron) const
@@ -39,14 +42,31 @@ std::array<std::bitset<20>, 65>
 FGRow::set_formatter() const
 {
 	std::array<std::bitset<20>, 65> r;
+	for (size_t ii = 0; ii < r.size(); ++ii)
+		r[ii] = mFormatted[ii];
+	return r;
+}
 
-	r[0] = static_cast<value_type>(mShared);
-	// set mNeuron parameter
-	for (size_t nrn=0; nrn<128; ++nrn) {
-		r[(nrn+1)/2] |= (static_cast<value_type>(mNeuron[nrn]) << (nrn%2 ? 0 : 10));
-	}
+FGRow::formatted_row_t const& FGRow::getFormatted() const
+{
+	return mFormatted;
+}
 
-	return r;
+void FGRow::format(formatted_row_t& words, size_t const column, value_type const value)
+{
+	// word 0 holds the shared value (low bits) and neuron 0 (high bits), word
+	// 1 neuron 1 (low bits) and neuron 2 (high bits) etc.
+	size_t const shift = column % 2 ? 10 : 0;
+	uint32_t& word = words[column / 2];
+	word = (word & ~(uint32_t(0x3ff) << shift)) | (uint32_t(value) << shift);
+}
+
+void FGRow::updateFormatted()
+{
+	mFormatted.fill(0);
+	format(mFormatted, 0, mShared);
+	for (size_t nrn = 0; nrn < mNeuron.size(); ++nrn)
+		format(mFormatted, nrn + 1, mNeuron[nrn]);
 }
 
 bool operator== (FGRow const & a, FGRow const & b)
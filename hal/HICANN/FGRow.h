@@ -4,6 +4,7 @@
 #include <array>
 #endif
 #include <bitset>
+#include <cstdint>
 
 #include "halco/hicann/v2/fwd.h"
 #include "pywrap/compat/rant.hpp"
@@ -34,11 +35,23 @@ struct FGRow
 
 #ifndef PYPLUSPLUS
 	std::array<std::bitset<20>, 65> set_formatter() const;
+
+	/// FG controller RAM words of a row, two 10 bit values per word in hardware order
+	typedef std::array<uint32_t, 65> formatted_row_t;
+
+	/// Preformatted RAM words, kept up to date by all setters.
+	formatted_row_t const& getFormatted() const;
+
+	/// Sets the value of a column (0: shared, 1-128: neurons) in formatted RAM words.
+	static void format(formatted_row_t& words, size_t column, value_type value);
 #endif // PYPLUSPLUS
 private:
 	rant::integral_range<value_type, 1023> mShared;
 #ifndef PYPLUSPLUS
 	std::array<rant::integral_range<value_type, 1023>, fg_columns-1> mNeuron;
+	formatted_row_t mFormatted;
+
+	void updateFormatted();
 #endif // PYPLUSPLUS
 };
 
@@ -49,6 +62,8 @@ void FGRow::serialize(Archiver & ar, unsigned int const)
 	using boost::serialization::make_nvp;
 	ar & make_nvp("shared", mShared)
 	   & make_nvp("neuron", mNeuron);
+	if (Archiver::is_loading::value)
+		updateFormatted();
 }
 #endif
 
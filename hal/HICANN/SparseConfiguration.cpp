@@ -0,0 +1,76 @@
+#include "hal/HICANN/SparseConfiguration.h"
+
+namespace HMF {
+namespace HICANN {
+
+namespace {
+
+template <typename Key, typename Value>
+void diff_entries(
+	std::map<Key, Value> const& previous,
+	std::map<Key, Value> const& next,
+	std::map<Key, Value>& changed)
+{
+	for (auto const& entry : next) {
+		auto const it = previous.find(entry.first);
+		if (it == previous.end() || it->second != entry.second)
+			changed.insert(changed.end(), entry);
+	}
+}
+
+} // namespace
+
+size_t SparseConfiguration::rows() const
+{
+	return synapse_controllers.size() + weights.size() + decoders.size() +
+	       crossbar_switches.size() + syndriver_switches.size() + horizontal_repeaters.size() +
+	       vertical_repeaters.size() + neuron_quads.size();
+}
+
+size_t SparseConfiguration::words() const
+{
+	return synapse_controllers.size() * words_per_synapse_controller +
+	       weights.size() * words_per_weights_row +
+	       decoders.size() * words_per_decoder_double_row +
+	       crossbar_switches.size() * words_per_crossbar_row +
+	       syndriver_switches.size() * words_per_syndriver_switch_row +
+	       (horizontal_repeaters.size() + vertical_repeaters.size()) * words_per_repeater +
+	       neuron_quads.size() * words_per_neuron_quad;
+}
+
+bool SparseConfiguration::empty() const
+{
+	return rows() == 0;
+}
+
+bool SparseConfiguration::operator==(SparseConfiguration const& other) const
+{
+	return synapse_controllers == other.synapse_controllers && weights == other.weights &&
+	       decoders == other.decoders && crossbar_switches == other.crossbar_switches &&
+	       syndriver_switches == other.syndriver_switches &&
+	       horizontal_repeaters == other.horizontal_repeaters &&
+	       vertical_repeaters == other.vertical_repeaters && neuron_quads == other.neuron_quads;
+}
+
+bool SparseConfiguration::operator!=(SparseConfiguration const& other) const
+{
+	return !(*this == other);
+}
+
+SparseConfiguration diff(SparseConfiguration const& previous, SparseConfiguration const& next)
+{
+	SparseConfiguration changed;
+	diff_entries(previous.synapse_controllers, next.synapse_controllers, changed.synapse_controllers);
+	diff_entries(previous.weights, next.weights, changed.weights);
+	diff_entries(previous.decoders, next.decoders, changed.decoders);
+	diff_entries(previous.crossbar_switches, next.crossbar_switches, changed.crossbar_switches);
+	diff_entries(previous.syndriver_switches, next.syndriver_switches, changed.syndriver_switches);
+	diff_entries(
+	    previous.horizontal_repeaters, next.horizontal_repeaters, changed.horizontal_repeaters);
+	diff_entries(previous.vertical_repeaters, next.vertical_repeaters, changed.vertical_repeaters);
+	diff_entries(previous.neuron_quads, next.neuron_quads, changed.neuron_quads);
+	return changed;
+}
+
+} // HICANN
+} // HMF
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <map>
+#include <utility>
+
+#include "halco/common/geometry.h"
+#include "halco/hicann/v2/l1.h"
+#include "halco/hicann/v2/neuron.h"
+#include "halco/hicann/v2/synapse.h"
+
+#include "hal/HICANNContainer.h"
+
+namespace HMF {
+namespace HICANN {
+
+/**
+ * Partial HICANN configuration in terms of the rows and registers written by
+ * the backend setters (e.g. set_weights_row, set_crossbar_switch_row).
+ *
+ * Entries which are not contained are left untouched when uploading the
+ * configuration (cf. upload_config_diff).
+ */
+struct SparseConfiguration
+{
+	typedef std::pair<halco::hicann::v2::HLineOnHICANN, halco::common::Side> crossbar_row_type;
+
+	/// SRAM words (or registers) written per entry, cf. words()
+	static size_t const words_per_synapse_controller = 9;
+	static size_t const words_per_weights_row = 32;
+	static size_t const words_per_decoder_double_row = 64;
+	static size_t const words_per_crossbar_row = 1;
+	static size_t const words_per_syndriver_switch_row = 1;
+	static size_t const words_per_repeater = 1;
+	static size_t const words_per_neuron_quad = 4;
+
+	/// Also used to write the weights and decoders of the respective array
+	std::map<halco::hicann::v2::SynapseArrayOnHICANN, SynapseController> synapse_controllers;
+	std::map<halco::hicann::v2::SynapseRowOnHICANN, WeightRow> weights;
+	std::map<halco::hicann::v2::SynapseDriverOnHICANN, DecoderDoubleRow> decoders;
+	std::map<crossbar_row_type, CrossbarRow> crossbar_switches;
+	std::map<halco::hicann::v2::SynapseSwitchRowOnHICANN, SynapseSwitchRow> syndriver_switches;
+	std::map<halco::hicann::v2::HRepeaterOnHICANN, HorizontalRepeater> horizontal_repeaters;
+	std::map<halco::hicann::v2::VRepeaterOnHICANN, VerticalRepeater> vertical_repeaters;
+	std::map<halco::hicann::v2::QuadOnHICANN, NeuronQuad> neuron_quads;
+
+	/// Number of entries, i.e. of setter calls needed to upload the configuration
+	size_t rows() const;
+	/// Number of SRAM words (or registers) written when uploading the configuration
+	size_t words() const;
+	bool empty() const;
+
+	bool operator==(SparseConfiguration const& other) const;
+	bool operator!=(SparseConfiguration const& other) const;
+};
+
+/**
+ * Returns the entries of next which are missing in or differ from previous,
+ * i.e. the minimal set of writes turning a HICANN configured with previous
+ * into one configured with next.
+ */
+SparseConfiguration diff(SparseConfiguration const& previous, SparseConfiguration const& next);
+
+} // HICANN
+} // HMF
@@ -4,22 +4,20 @@
 namespace HMF {
 namespace HICANN {
 
+namespace {
+
+/// positions of the switches on the left side of a row, cf. SparseSwitchMatrix::index
+template <typename Row>
+Row left_side_mask()
+{
+	return Row().set() >> (Row().size() / 2);
+}
+
+} // namespace
+
 bool SynapseSwitch::exists(x_type x, y_type y)
 {
-	size_t x_mod = x % 32;
-	size_t y_mod = y % 16;
-
-	y_mod -= y_mod%2;
-	y_mod /= 2;
-	x_mod /= 4;
-
-	if(y < y_type::end/2) {
-		/* halco::common::TOP */
-		return x<128  ? y_mod==x_mod : (7-y_mod)==x_mod;
-	} else {
-		/* halco::common::BOTTOM */
-		return x>=128 ? y_mod==x_mod : (7-y_mod)==x_mod;
-	}
+	return exists_enum(x, y);
 }
 
 bool SynapseSwitch::local(x_type x, y_type y) {
@@ -35,14 +33,12 @@ SynapseSwitch::x_lines_for_row_type SynapseSwitch::get_lines(
     halco::hicann::v2::SynapseSwitchRowOnHICANN const& s) {
 	x_lines_for_row_type some;
 
-	const x_lines_type all = get_lines(s.line());
-	const auto side = s.toSideHorizontal();
-
-	// return only vlines that match the side of the synapse switch row
-	std::copy_if(all.begin(), all.end(), some.begin(),
-	[&side](halco::hicann::v2::VLineOnHICANN const& v) -> bool {
-		return !((v < (halco::hicann::v2::VLineOnHICANN::end/2)) xor (side == halco::common::left));
-	});
+	// positions of the left vlines precede the ones of the right vlines, cf. index
+	auto const& row = lines_table()[s.line()];
+	size_t const offset = s.toSideHorizontal() == halco::common::left ? 0 : some.size();
+	for (size_t idx = 0; idx < some.size(); ++idx) {
+		some[idx] = x_type(row[offset + idx]);
+	}
 	return some;
 }
 
@@ -54,23 +50,19 @@ std::string SynapseSwitch::check_exclusiveness(
 
 	std::stringstream errors;
 
+	row_type const left_mask = left_side_mask<row_type>();
+
 	// row-wise
 	for (size_t yy = 0; yy < y_type::end; ++yy) {
 		// halco::common::left
-		size_t cnt = 0;
-		for (size_t xx = 0; xx < periods * period_length/2; ++xx) {
-			cnt += switches()[yy][xx];
-		}
+		size_t cnt = (switches()[yy] & left_mask).count();
 		if (cnt > max_switches_per_row) {
 			errors << cnt << " switches (ie. more than "
 				   << max_switches_per_row
 				   << ") enabled on halco::common::left side in row " << yy;
 		}
 		// halco::common::right
-		cnt = 0;
-		for (size_t xx = periods * period_length/2; xx < periods * period_length; ++xx) {
-			cnt += switches()[yy][xx];
-		}
+		cnt = (switches()[yy] & ~left_mask).count();
 		if (cnt > max_switches_per_row) {
 			errors << "SynapseSwitch: " << cnt << " switches (ie. more than "
 				   << max_switches_per_row
@@ -79,20 +71,11 @@ std::string SynapseSwitch::check_exclusiveness(
 	}
 
 	// column-wise but left and right separately
+	column_counts_type const counts = count_columns();
 	for (size_t xx = 0; xx < x_type::end; ++xx) {
 
-		size_t cnt_left = 0;
-		size_t cnt_right = 0;
-
-		for (size_t yy = 0; yy < y_type::end; ++yy) {
-			if (exists(x_type(xx), y_type(yy))) {
-				if( xx < x_type::end/2 ) {
-					cnt_left += get(x_type(xx), y_type(yy));
-				} else {
-					cnt_right += get(x_type(xx), y_type(yy));
-				}
-			}
-		}
+		size_t const cnt_left = xx < x_type::end/2 ? counts[xx] : 0;
+		size_t const cnt_right = xx < x_type::end/2 ? 0 : counts[xx];
 
 		if (cnt_left > max_switches_per_column_per_side ||
 		    cnt_right > max_switches_per_column_per_side) {
@@ -113,20 +96,14 @@ std::string SynapseSwitch::check_exclusiveness(
  */
 void SynapseSwitch::check_exclusiveness(const SynapseSwitch & right_neighbour) const
 {
+	row_type const left_mask = left_side_mask<row_type>();
+
 	// row-wise
 	for (size_t yy = 0; yy < y_type::end; ++yy) {
-		size_t cnt = 0;
-		// halco::common::right SIDE of this hicann.
-		for (size_t xx = periods * period_length/2; xx < periods * period_length; ++xx) {
-			cnt += switches()[yy][xx];
-		}
-		// halco::common::left SIDE of right neighbour hicann.
-		halco::hicann::v2::SynapseSwitchRowOnHICANN addr(y_type(yy), halco::common::left);
-		SynapseSwitchRow switch_row_nb = right_neighbour.get_row(addr);
-		typedef SynapseSwitchRow::iterator SSR_Iter;
-		for ( SSR_Iter it = switch_row_nb.begin(); it != switch_row_nb.end(); ++it ) {
-			cnt +=  *it;
-		}
+		// halco::common::right SIDE of this hicann and halco::common::left SIDE of right
+		// neighbour hicann.
+		size_t const cnt = (switches()[yy] & ~left_mask).count() +
+		                   (right_neighbour.switches()[yy] & left_mask).count();
 		if (cnt > 1) {
 			std::stringstream error_string;
 			error_string << "SynapseSwitch::check_exclusiveness(right_neighbour): more than one switch enabled in row " << yy;
@@ -135,18 +112,16 @@ void SynapseSwitch::check_exclusiveness(const SynapseSwitch & right_neighbour) c
 	}
 }
 
-SynapseSwitchRow const&
+SynapseSwitchRow
 SynapseSwitch::get_row(halco::hicann::v2::SynapseSwitchRowOnHICANN const& drv) const
 {
-	return reinterpret_cast<SynapseSwitchRow const&>(
-		switches()[drv.line()][drv.toSideHorizontal()*4*4]);
+	return get_bits<SynapseSwitchRow>(drv.line(), drv.toSideHorizontal()*4*4);
 }
 
 void SynapseSwitch::set_row(halco::hicann::v2::SynapseSwitchRowOnHICANN const& drv,
 			SynapseSwitchRow const& row)
 {
-	reinterpret_cast<SynapseSwitchRow &>(
-		switches()[drv.line()][drv.toSideHorizontal()*4*4]) = row;
+	set_bits(drv.line(), drv.toSideHorizontal()*4*4, row);
 }
 
 } // HICANN
@@ -25,6 +25,20 @@ public:
 		x_lines_for_row_type;
 
 	static bool exists(x_type x, y_type y);
+	/// exists() on the enum values of the coordinates, usable at compile time
+	static PYPP_CONSTEXPR bool exists_enum(size_t x, size_t y)
+	{
+		size_t const x_mod = x % 32 / 4;
+		size_t const y_mod = y % 16 / 2;
+
+		if (y < y_type::end / 2) {
+			/* halco::common::TOP */
+			return x < 128 ? y_mod == x_mod : (7 - y_mod) == x_mod;
+		} else {
+			/* halco::common::BOTTOM */
+			return x >= 128 ? y_mod == x_mod : (7 - y_mod) == x_mod;
+		}
+	}
 
 	// connects to local or neighbouring HICANN
 	static bool local(x_type x, y_type y);
@@ -53,7 +67,7 @@ public:
 	 */
 	void check_exclusiveness(const SynapseSwitch & right_neighbour) const;
 
-	SynapseSwitchRow const&
+	SynapseSwitchRow
 	get_row(halco::hicann::v2::SynapseSwitchRowOnHICANN const& drv) const;
 	void set_row(halco::hicann::v2::SynapseSwitchRowOnHICANN const& drv,
 			SynapseSwitchRow const& row);
@@ -1,6 +1,7 @@
 #include "hal/Handle/Dump.h"
 
 #include <array>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
@@ -66,6 +67,10 @@ Dump::Dump() :
 		bool append = std::getenv("HALBE_XMLDUMP_APPEND");
 		enableXmlDump(file, append);
 	}
+	if(char const * file = std::getenv("HALBE_BINARYDUMP_FILE")) {
+		bool append = std::getenv("HALBE_BINARYDUMP_APPEND");
+		enableBinaryDump(file, append);
+	}
 }
 
 static std::ios_base::openmode openmode(bool append)
@@ -87,5 +92,40 @@ void Dump::enableXmlDump(std::string filename, bool append) {
 	xml_archive.reset(new XmlArchive(filename, append));
 }
 
+Dump::BinaryArchive::BinaryArchive(std::string filename, bool append) :
+	file(filename, std::ios_base::binary | openmode(append)),
+	index(filename + binary_dump::index_suffix, std::ios_base::binary | openmode(append)),
+	offset(0)
+{
+	if (!file || !index)
+		throw std::runtime_error("cannot open binary dump " + filename);
+	if (append) {
+		file.seekp(0, std::ios_base::end);
+		offset = file.tellp();
+	}
+}
+
+void Dump::BinaryArchive::write(char const* name, std::string const& payload)
+{
+	binary_dump::RecordHeader const header{
+		binary_dump::record_magic, static_cast<std::uint32_t>(std::strlen(name)),
+		payload.size()};
+	file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+	file.write(name, header.name_size);
+	file.write(payload.data(), payload.size());
+
+	binary_dump::IndexEntry const entry{
+		offset, sizeof(header) + header.name_size + header.payload_size};
+	index.write(reinterpret_cast<char const*>(&entry), sizeof(entry));
+	offset += entry.size;
+
+	if (!file || !index)
+		throw std::runtime_error("error writing binary dump");
+}
+
+void Dump::enableBinaryDump(std::string filename, bool append) {
+	binary_archive.reset(new BinaryArchive(filename, append));
+}
+
 } // namespace Handle
 } // namespace HMF
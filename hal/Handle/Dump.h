@@ -1,6 +1,7 @@
 #pragma once
 
 #include <bitset>
+#include <cstdint>
 #include <string>
 
 #include <boost/shared_ptr.hpp>
@@ -8,8 +9,13 @@
 #include "pywrap/compat/macros.hpp"
 
 #ifndef PYPLUSPLUS
+#include "hal/Handle/dump/binary_dump.h"
 #include "hal/Handle/dump/dump_helper.h"
 
+#include <fstream>
+#include <sstream>
+
+#include <boost/archive/binary_oarchive.hpp>
 #include <boost/archive/xml_oarchive.hpp>
 #endif // !PYPLUSPLUS
 
@@ -28,6 +34,18 @@ struct Dump :
 
 	void enableXmlDump(std::string filename, bool append = false);
 
+	/**
+	 * Writes all calls to a binary dump, a much faster and more compact
+	 * alternative to the xml dump.
+	 *
+	 * Each call is a record of its own (cf. binary_dump), which is indexed in
+	 * filename + ".index".  Use BinaryDumpReader (or halbe_dump_reader) to
+	 * inspect or replay it.
+	 *
+	 * @note Dumps are not compressed to allow random access.
+	 */
+	void enableBinaryDump(std::string filename, bool append = false);
+
 private:
 	int experiment_id;
 	size_t calls;
@@ -41,8 +59,19 @@ private:
 	};
 	std::unique_ptr<XmlArchive>					   xml_archive;
 
+	struct BinaryArchive {
+		BinaryArchive(std::string filename, bool append);
+		void write(char const* name, std::string const& payload);
+		std::ofstream file;
+		std::ofstream index;
+		std::uint64_t offset;
+		// reused for the payload of each call
+		std::ostringstream buffer;
+	};
+	std::unique_ptr<BinaryArchive>                 binary_archive;
+
 	template <typename Handle, typename ... Args>
-	void dump(std::string name, const Handle & h, Args const & ... args);
+	void dump(char const* name, const Handle & h, Args const & ... args);
 
 	void gen_experiment_id();
 #endif // !PYPLUSPLUS
@@ -53,16 +82,27 @@ private:
 
 #ifndef PYPLUSPLUS
 template <typename Handle, typename ... Args>
-void Dump::dump(std::string name, const Handle & h, Args const & ... args) {
+void Dump::dump(char const* name, const Handle & h, Args const & ... args) {
 	using boost::serialization::make_nvp;
 
 	const auto coordinate = h.coordinate();
 
 	if (xml_archive) {
-		xml_archive->archive << make_nvp("type", name);
+		std::string const type(name);
+		xml_archive->archive << make_nvp("type", type);
 		dump_helper(xml_archive->archive, coordinate, args...);
 	}
 
+	if (binary_archive) {
+		auto& buffer = binary_archive->buffer;
+		buffer.str(std::string());
+		{
+			boost::archive::binary_oarchive archive(buffer, boost::archive::no_header);
+			dump_helper(archive, coordinate, args...);
+		}
+		binary_archive->write(name, buffer.str());
+	}
+
 	++calls;
 }
 #endif // !PYPLUSPLUS
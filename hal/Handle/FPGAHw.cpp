@@ -34,7 +34,7 @@ struct FPGAHw::FPGAHandlePIMPL {
 	      dnc(d),
 	      fpga_jtag_port(halco::hicann::v2::UDPPort(jtag_base_port + d.value())),
 	      on_wafer(on_wafer),
-	      myPowerBackend(std::unique_ptr<PowerBackend>(new PowerBackend())),
+	      myPowerBackend(PowerBackend::shared()),
 	      physically_available_hicanns(physically_available_hicanns),
 	      highspeed_hicanns(highspeed_hicanns),
 	      usable_hicanns(usable_hicanns),
@@ -60,12 +60,12 @@ struct FPGAHw::FPGAHandlePIMPL {
 
 	void setup() {
 		myPowerBackend->SetupReticle(
-		    fpga.dnc(dnc), fpga, fpga_jtag_port, pmu_ip, physically_available_hicanns,
+		    fpga, fpga.dnc(dnc), fpga_jtag_port, pmu_ip, physically_available_hicanns,
 		    highspeed_hicanns, on_wafer, arq_mode, jtag_frequency);
 	}
 
 	~FPGAHandlePIMPL() {
-		myPowerBackend->destroy_reticle(fpga.dnc(dnc));
+		myPowerBackend->destroy_reticle(fpga, fpga.dnc(dnc));
 	}
 
 
@@ -73,7 +73,9 @@ struct FPGAHw::FPGAHandlePIMPL {
 	halco::hicann::v2::DNCOnFPGA const dnc;
 	halco::hicann::v2::UDPPort const fpga_jtag_port;
 	bool const on_wafer;
-	std::unique_ptr<HMF::PowerBackend> myPowerBackend;
+	// shared by all FPGA handles, reticles are distinguished by their DNCGlobal
+	// and kept as long as any of their owning handles exists
+	boost::shared_ptr<HMF::PowerBackend> myPowerBackend;
 	std::set<halco::hicann::v2::HICANNOnDNC> physically_available_hicanns;
 	std::set<halco::hicann::v2::HICANNOnDNC> highspeed_hicanns;
 	std::set<halco::hicann::v2::HICANNOnDNC> usable_hicanns;
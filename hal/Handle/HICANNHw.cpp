@@ -26,5 +26,51 @@ uint8_t HICANNHw::jtag_addr() const
 	return m_jtag_addr;
 }
 
+HICANNHw::FGControllerState::FGControllerState() :
+	config(),
+	issued(),
+	ram_bank(),
+	ram_row(),
+	write_cycles(0),
+	polls(0),
+	poll_time(0),
+	wait_time(0),
+	programmed(),
+	programmed_config(),
+	row_time(0)
+{}
+
+HICANNHw::FGControllerState& HICANNHw::fg_controller_state()
+{
+	return m_fg_controller_state;
+}
+
+HICANNHw::ShadowState::ShadowState() : enabled(false), serve_reads(false) {}
+
+void HICANNHw::ShadowState::clear()
+{
+	weights.clear();
+	decoders.clear();
+	crossbar.clear();
+	merger_tree = boost::none;
+	synapse_controllers.clear();
+}
+
+HICANNHw::ShadowState& HICANNHw::shadow_state()
+{
+	return m_shadow_state;
+}
+
+HICANNHw::SynapseControllerState::SynapseControllerState() :
+	poll_status(false),
+	dummy_writes(0),
+	polls(0)
+{}
+
+HICANNHw::SynapseControllerState& HICANNHw::synapse_controller_state()
+{
+	return m_synapse_controller_state;
+}
+
 }// namespace Handle
 } // namespace HMF
@@ -1,7 +1,18 @@
 #pragma once
 
+#include <array>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <utility>
+
+#include <boost/optional.hpp>
 #include <boost/weak_ptr.hpp>
 
+#include "hal/HICANNContainer.h"
+#include "hal/HICANN/FGConfig.h"
+#include "hal/HICANN/FGControl.h"
+#include "hal/HICANN/MergerTree.h"
 #include "hal/Handle/HICANN.h"
 #include "hal/Handle/FPGA.h"
 
@@ -29,6 +40,87 @@ struct HICANNHw : public HICANN
 	PYPP_EXCLUDE(boost::shared_ptr<facets::ReticleControl> get_reticle();)
 	uint8_t jtag_addr() const;
 
+#ifndef PYPLUSPLUS
+	/// State of the floating gate controllers as seen by the backend, used to
+	/// schedule status reads while waiting for write cycles (cf. fg_busy_wait).
+	struct FGControllerState
+	{
+		FGControllerState();
+
+		/// Configuration as last written via set_fg_config
+		std::array<HMF::HICANN::FGConfig, 4> config;
+		/// Time the last write cycle has been issued
+		std::array<std::chrono::steady_clock::time_point, 4> issued;
+		/// RAM bank holding the values of the last upload (cf. fg_ram_access)
+		std::array<bool, 4> ram_bank;
+		/// Row of the values of the last upload, if known
+		std::array<boost::optional<size_t>, 4> ram_row;
+
+		/// Number of awaited write cycles (per FG block)
+		size_t write_cycles;
+		/// Number of status reads
+		size_t polls;
+		/// Time spent on status reads, i.e. on the link
+		std::chrono::nanoseconds poll_time;
+		/// Total time spent waiting for the controllers
+		std::chrono::nanoseconds wait_time;
+
+		/// Values programmed by the last update_fg_values, reset by any other write cycle
+		std::unique_ptr<HMF::HICANN::FGControl> programmed;
+		/// Configuration used by the last update_fg_values
+		std::array<HMF::HICANN::FGConfig, 4> programmed_config;
+		/// Measured duration of programming one row in all FG blocks (cf. update_fg_values)
+		std::chrono::nanoseconds row_time;
+	};
+
+	FGControllerState& fg_controller_state();
+
+	/// Configuration as last written to (or read from) the HICANN, used to answer getters
+	/// without hardware accesses (cf. HICANN::set_shadow_mode).
+	struct ShadowState
+	{
+		ShadowState();
+
+		/// Setters and getters update the cache
+		bool enabled;
+		/// Getters answer from the cache if possible
+		bool serve_reads;
+
+		std::map<halco::hicann::v2::SynapseRowOnHICANN, HMF::HICANN::WeightRow> weights;
+		std::map<halco::hicann::v2::SynapseDriverOnHICANN, HMF::HICANN::DecoderDoubleRow> decoders;
+		std::map<
+		    std::pair<halco::hicann::v2::HLineOnHICANN, halco::common::Side>,
+		    HMF::HICANN::CrossbarRow>
+		    crossbar;
+		boost::optional<HMF::HICANN::MergerTree> merger_tree;
+
+		/// Synapse controllers as last used for the synapse arrays, needed to read back
+		/// weights and decoders
+		std::map<halco::hicann::v2::SynapseArrayOnHICANN, HMF::HICANN::SynapseController>
+		    synapse_controllers;
+
+		/// Drops all cached values, the enabled flags are kept
+		void clear();
+	};
+
+	ShadowState& shadow_state();
+
+	/// Waits for the synapse controllers (cf. HICANN::set_synapse_wait_mode, wait_by_dummy).
+	struct SynapseControllerState
+	{
+		SynapseControllerState();
+
+		/// Wait by polling the status register instead of sending dummy writes
+		bool poll_status;
+
+		/// Number of dummy writes rsp. status reads sent for waiting
+		size_t dummy_writes;
+		size_t polls;
+	};
+
+	SynapseControllerState& synapse_controller_state();
+#endif // !PYPLUSPLUS
+
 	/// Construct a HICANN that is connected to FPGA f
 	HICANNHw(halco::hicann::v2::HICANNGlobal const& h,
 	         const boost::shared_ptr<facets::ReticleControl>& rc, uint8_t jtag_addr,
@@ -37,6 +129,11 @@ struct HICANNHw : public HICANN
 private:
 	boost::weak_ptr<facets::ReticleControl> mReticleControl;
 	const uint8_t m_jtag_addr;
+#ifndef PYPLUSPLUS
+	FGControllerState m_fg_controller_state;
+	ShadowState m_shadow_state;
+	SynapseControllerState m_synapse_controller_state;
+#endif // !PYPLUSPLUS
 };
 
 } // namespace Handle
@@ -2,6 +2,8 @@
 
 #include <stdexcept>
 
+#include <boost/weak_ptr.hpp>
+
 #include "hal/Handle/HICANNHw.h"
 #include "hal/Handle/FPGAHw.h"
 
@@ -24,6 +26,76 @@ PowerBackend::PowerBackend() : all_reticles() {}
 
 PowerBackend::~PowerBackend() {}
 
+boost::shared_ptr<PowerBackend> PowerBackend::shared()
+{
+	// the backend lives as long as any FPGA handle uses it
+	static std::mutex mutex;
+	static boost::weak_ptr<PowerBackend> instance;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	boost::shared_ptr<PowerBackend> ptr = instance.lock();
+	if (!ptr) {
+		ptr.reset(new PowerBackend());
+		instance = ptr;
+	}
+	return ptr;
+}
+
+size_t PowerBackend::size() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return all_reticles.size();
+}
+
+PowerBackend::Reticle const* PowerBackend::find(halco::hicann::v2::DNCGlobal const d) const
+{
+	auto it = all_reticles.find(size_t(d.toEnum()));
+	if (it == all_reticles.end())
+		return nullptr;
+	return &it->second;
+}
+
+PowerBackend::Reticle const* PowerBackend::find(
+    Handle::FPGAHw const& f, halco::hicann::v2::DNCGlobal const d) const
+{
+	Reticle const* const reticle = find(d);
+	if (!reticle || !reticle->owners.count(&f))
+		return nullptr;
+	return reticle;
+}
+
+uint8_t PowerBackend::ReticleLUT::jtag_addr(halco::hicann::v2::HICANNOnDNC const& h) const
+{
+	size_t const hs_channel = h.toHighspeedLinkOnDNC().toEnum();
+	if (!available.test(hs_channel)) {
+		std::stringstream ss;
+		ss << h << " is not available on its reticle";
+		throw std::out_of_range(ss.str());
+	}
+	return hs2jtag[hs_channel];
+}
+
+PowerBackend::ReticleLUT PowerBackend::make_lut(
+    std::set<halco::hicann::v2::HICANNOnDNC> const& physically_available_hicanns,
+    std::set<halco::hicann::v2::HICANNOnDNC> const& highspeed_hicanns)
+{
+	ReticleLUT lut;
+	lut.hs2jtag.fill(0);
+
+	// the bitsets are also used by ReticleControl, hence in hs channel ordering
+	size_t jtag_num = physically_available_hicanns.size();
+	for (auto const hs_link : halco::common::iter_all<halco::hicann::v2::HighspeedLinkOnDNC>()) {
+		if (physically_available_hicanns.count(hs_link.toHICANNOnDNC())) {
+			lut.available.set(hs_link.toEnum());
+			lut.hs2jtag[hs_link.toEnum()] = --jtag_num;
+		}
+		if (highspeed_hicanns.count(hs_link.toHICANNOnDNC())) {
+			lut.highspeed.set(hs_link.toEnum());
+		}
+	}
+	return lut;
+}
+
 HostALController&
 PowerBackend::get_host_al(Handle::FPGAHw const& f) {
 	// FIXME getting access to the HostAL should not go via reticle control
@@ -34,63 +106,65 @@ PowerBackend::get_host_al(Handle::FPGAHw const& f) {
 		throw std::runtime_error("cannot access HostAL, S2C_JtgPhys2FPGA runs without ARQ");
 }
 
-
-template<typename T /*std::pair*/>
-struct CompareFirstOfPair {
-	CompareFirstOfPair(typename T::first_type val) :
-		val(val)
-	{}
-
-	bool operator()(T const & elem) const {
-		return val == elem.first;
-	}
-private:
-	typename T::first_type val;
-};
-
 boost::shared_ptr<facets::ReticleControl> PowerBackend::get_reticle_ptr(halco::hicann::v2::DNCGlobal const d) {
-	auto it = std::find_if(all_reticles.begin(), all_reticles.end(), CompareFirstOfPair<decltype(all_reticles)::value_type>(d));
-	if (it == all_reticles.end()) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	Reticle const* const reticle = find(d);
+	if (!reticle) {
 		std::stringstream ss;
 		ss << "Could not find matching reticle: " << d << std::endl;
 		throw std::runtime_error(ss.str());
 	}
-	return it->second;
+	return reticle->control;
 }
 
 ReticleControl& PowerBackend::get_reticle(halco::hicann::v2::DNCGlobal const d) {
-	return *get_reticle_ptr(d);
+	// the instance is kept by the container until the last owner releases it
+	std::lock_guard<std::mutex> lock(m_mutex);
+	Reticle const* const reticle = find(d);
+	if (!reticle) {
+		std::stringstream ss;
+		ss << "Could not find matching reticle: " << d << std::endl;
+		throw std::runtime_error(ss.str());
+	}
+	return *(reticle->control);
 }
 
 ReticleControl& PowerBackend::get_reticle(Handle::FPGAHw const & f, halco::hicann::v2::DNCOnFPGA const d) {
-	return get_reticle(f.dnc(d));
+	std::lock_guard<std::mutex> lock(m_mutex);
+	Reticle const* const reticle = find(f, f.dnc(d));
+	if (!reticle) {
+		std::stringstream ss;
+		ss << "Could not find matching reticle of FPGA " << f.coordinate() << ": " << d << std::endl;
+		throw std::runtime_error(ss.str());
+	}
+	return *(reticle->control);
 }
 
 ReticleControl& PowerBackend::get_some_reticle(Handle::FPGAHw const & f) {
-	for (size_t i = halco::hicann::v2::DNCOnFPGA::min; i <= halco::hicann::v2::DNCOnFPGA::max; i++) {
-		halco::hicann::v2::DNCOnFPGA const d{Enum(i)};
-		auto it = std::find_if(all_reticles.begin(), all_reticles.end(), CompareFirstOfPair<decltype(all_reticles)::value_type>(f.dnc(d)));
-		if (it != all_reticles.end())
-			return *(it->second);
+	std::lock_guard<std::mutex> lock(m_mutex);
+	for (auto const d : halco::common::iter_all<halco::hicann::v2::DNCOnFPGA>()) {
+		if (Reticle const* const reticle = find(f, f.dnc(d)))
+			return *(reticle->control);
 	}
 	std::stringstream ss;
 	ss << "Could not find any reticle from FPGA: " << f.coordinate() << std::endl;
 	throw std::runtime_error(ss.str());
 }
 
-void PowerBackend::destroy_reticle(halco::hicann::v2::DNCGlobal const d) {
-	auto it = std::find_if(all_reticles.begin(), all_reticles.end(), CompareFirstOfPair<decltype(all_reticles)::value_type>(d));
-	if (it == all_reticles.end()) {
+void PowerBackend::destroy_reticle(Handle::FPGAHw const& f, halco::hicann::v2::DNCGlobal const d) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	auto it = all_reticles.find(size_t(d.toEnum()));
+	if (it == all_reticles.end() || !it->second.owners.erase(&f)) {
 		std::stringstream ss;
 		ss << "Cannot destroy reticle because it doesn't exist: ";
 		ss << d << " (" << d.toFPGAGlobal() << ")\n";
 		ss << "Existing reticles: ";
 		for (auto & r: all_reticles)
-			ss << r.first << "\n";
+			ss << r.second.dnc << "\n";
 		Logger & log = Logger::instance();
 		log(Logger::WARNING) << ss.str() << Logger::flush;
-	} else {
-		if (it->second.use_count() != 1)
+	} else if (it->second.owners.empty()) {
+		if (it->second.control.use_count() != 1)
 		{
 			std::stringstream ss;
 			ss << "Cannot destroy reticle '"
@@ -102,17 +176,31 @@ void PowerBackend::destroy_reticle(halco::hicann::v2::DNCGlobal const d) {
 	}
 }
 
+halco::hicann::v2::JTAGFrequency PowerBackend::jtag_frequency(halco::hicann::v2::DNCGlobal const d) const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	Reticle const* const reticle = find(d);
+	if (!reticle) {
+		std::stringstream ss;
+		ss << "Could not find matching reticle: " << d << std::endl;
+		throw std::runtime_error(ss.str());
+	}
+	return reticle->jtag_frequency;
+}
+
 uint8_t PowerBackend::hicann_jtag_addr(halco::hicann::v2::HICANNGlobal const& h) {
-	//look up in ReticleControl how many HICANNs it has
-	uint8_t hs_channel = h.toHICANNOnDNC().toHighspeedLinkOnDNC().toEnum();
-	assert (hs2jtag_lut.count(hs_channel) > 0);
-	return hs2jtag_lut[hs_channel];
+	std::lock_guard<std::mutex> lock(m_mutex);
+	Reticle const* const reticle = find(h.toDNCGlobal());
+	if (!reticle) {
+		std::stringstream ss;
+		ss << "Could not find matching reticle of " << h << std::endl;
+		throw std::runtime_error(ss.str());
+	}
+	return reticle->lut.jtag_addr(h.toHICANNOnDNC());
 }
 
-// single reticle usage
 void PowerBackend::SetupReticle(
+    Handle::FPGAHw const& f,
     halco::hicann::v2::DNCGlobal const d,
-    halco::hicann::v2::IPv4 fpga_ip,
     uint16_t jtag_port,
     halco::hicann::v2::IPv4 pmu_ip,
     std::set<halco::hicann::v2::HICANNOnDNC> physically_available_hicanns,
@@ -121,47 +209,52 @@ void PowerBackend::SetupReticle(
     bool arq_mode,
     halco::hicann::v2::JTAGFrequency jtag_freq)
 {
-	if (all_reticles.size() > 1) {
-		throw runtime_error("PowerBackend::SetupReticle: Too many reticles instantiated!");
-	}
-	if (all_reticles.size()) {
-		Logger & log = Logger::instance();
-		log(Logger::WARNING) << "Ignoring request to create another reticle instance.\n";
-		log(Logger::WARNING) << "Reticles in use: ";
-		for (auto & r: all_reticles) {
-			log(Logger::WARNING) << r.first << " ";
+	size_t const key = size_t(d.toEnum());
+	{
+		// another thread may be connecting to the same reticle, reserve it before connecting
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_setup_done.wait(lock, [this, key]() { return !m_pending.count(key); });
+		auto it = all_reticles.find(key);
+		if (it != all_reticles.end()) {
+			if (!it->second.owners.insert(&f).second) {
+				Logger & log = Logger::instance();
+				log(Logger::WARNING) << "Ignoring request to create another instance of reticle "
+				                     << d << Logger::flush;
+			}
+			return;
 		}
-		log(Logger::WARNING) << std::endl << Logger::flush;
-
-		return;
+		m_pending.insert(key);
 	}
 
-	// creation of array and bitset for reticlecontrol, also gets used to keep which hicanns are
-	// availabe in hs channel ordering
-	size_t jtag_num = physically_available_hicanns.size();
-	std::bitset<halco::hicann::v2::HighspeedLinkOnDNC::end> avail_hicann_bitset_in_hs_order;
-	std::bitset<halco::hicann::v2::HICANNOnDNC::enum_type::end> highspeed_bitset;
-	for (auto const hs_link : halco::common::iter_all<halco::hicann::v2::HighspeedLinkOnDNC>()) {
-		if (physically_available_hicanns.count(hs_link.toHICANNOnDNC())) {
-			avail_hicann_bitset_in_hs_order.set(hs_link.toEnum());
-			hs2jtag_lut[hs_link.toEnum()] = --jtag_num;
-		}
-		if (highspeed_hicanns.count(hs_link.toHICANNOnDNC())) {
-			highspeed_bitset.set(hs_link.toEnum());
+	Reticle reticle;
+	reticle.dnc = d;
+	reticle.lut = make_lut(physically_available_hicanns, highspeed_hicanns);
+	reticle.jtag_frequency = jtag_freq;
+	reticle.owners.insert(&f);
+
+	// connecting to the reticle takes a while, don't block other reticles meanwhile
+	try {
+		auto const bytes = f.ip().to_bytes();
+		ReticleControl::ip_t ip_(bytes[0], bytes[1], bytes[2], bytes[3]);
+		unsigned int const reticle_number = d.toDNCOnWafer().toEnum();
+		reticle.control.reset(new ReticleControl(
+		    reticle_number, ip_, jtag_port, pmu_ip, reticle.lut.available, reticle.lut.highspeed,
+		    on_wafer, arq_mode, jtag_freq.value() / 1e3));
+	} catch (...) {
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_pending.erase(key);
 		}
+		m_setup_done.notify_all();
+		throw;
 	}
 
-	auto const bytes = fpga_ip.to_bytes();
-	ReticleControl::ip_t ip_(bytes[0], bytes[1], bytes[2], bytes[3]);
-	unsigned int const reticle_number = d.toDNCOnWafer().toEnum();
-	auto ret = all_reticles.insert(std::make_pair(
-	    d, boost::shared_ptr<ReticleControl>(new ReticleControl(
-	           reticle_number, ip_, jtag_port, pmu_ip, avail_hicann_bitset_in_hs_order,
-	           highspeed_bitset, on_wafer,
-	           arq_mode, jtag_freq.value() / 1e3))));
-	if (!ret.second) {
-		throw runtime_error("PowerBackend::SetupReticle: Could not insert reticle");
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		all_reticles.insert(std::make_pair(key, reticle));
+		m_pending.erase(key);
 	}
+	m_setup_done.notify_all();
 }
 
 } // namespace HMF
@@ -1,8 +1,8 @@
 // Copyleft; i don't like header headers
 #pragma once
 
+#include <array>
 #include <bitset>
-#include <map>
 #include <string>
 #include <set>
 
@@ -13,7 +13,11 @@
 
 #ifndef PYPLUSPLUS
 #include <boost/shared_ptr.hpp>
+#include <condition_variable>
 #include <memory> // for unique_ptr
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 #endif
 
 // Fwd Decl
@@ -41,33 +45,68 @@ struct HICANNHw;
 /**
  * @class PowerBackend
  *
- * @brief Power and coordinate management of the reticlesand corresponding
+ * @brief Power and coordinate management of the reticles and corresponding
  * HICANNs
  *
- * @note Potentially intended to manage many reticles. For now only one as
- * the release does not foresee to use more than one HICANN
+ * A single instance (cf. shared()) is used by all FPGA handles of a process,
+ * hence one process can drive any number of reticles, e.g. a whole wafer.
+ * Reticles are looked up in constant time and all member functions may be
+ * called concurrently; the ReticleControl instances themselves are not
+ * thread-safe, i.e. each reticle must only be accessed by one thread at a time.
+ * A reticle is owned by the FPGA handles which set it up and is destroyed
+ * along with the last of them.
  */
 struct PowerBackend {
-	typedef std::map<halco::hicann::v2::DNCGlobal, boost::shared_ptr<facets::ReticleControl> > container_type;
-	container_type all_reticles;
+	/// Assignment of the HICANNs of a reticle to JTAG addresses and highspeed links.
+	struct ReticleLUT {
+		// LUT to assign jtag index to hs channel index, available HICANNs only
+		std::array<uint8_t, halco::hicann::v2::HighspeedLinkOnDNC::end> hs2jtag;
+		std::bitset<halco::hicann::v2::HighspeedLinkOnDNC::end> available;
+		std::bitset<halco::hicann::v2::HICANNOnDNC::enum_type::end> highspeed;
+
+		/// returns the JTAG address of h, throws std::out_of_range if h is not available
+		uint8_t jtag_addr(halco::hicann::v2::HICANNOnDNC const& h) const;
+	};
+
+	/// builds the LUT of a reticle with the given HICANNs, the JTAG chain
+	/// contains the available HICANNs in reverse order of their highspeed links
+	static ReticleLUT make_lut(
+	    std::set<halco::hicann::v2::HICANNOnDNC> const& physically_available_hicanns,
+	    std::set<halco::hicann::v2::HICANNOnDNC> const& highspeed_hicanns);
+
+	struct Reticle {
+		halco::hicann::v2::DNCGlobal dnc;
+		boost::shared_ptr<facets::ReticleControl> control;
+		ReticleLUT lut;
+		halco::hicann::v2::JTAGFrequency jtag_frequency;
+		// FPGA handles which set up the reticle
+		std::unordered_set<Handle::FPGAHw const*> owners;
+	};
+	// key is the enum value of the DNCGlobal
+	typedef std::unordered_map<size_t, Reticle> container_type;
+
+	/// returns the instance shared by all FPGA handles of this process
+	static boost::shared_ptr<PowerBackend> shared();
 
 	//returns a shared_ptr to the correct reticle
 	boost::shared_ptr<facets::ReticleControl> get_reticle_ptr(halco::hicann::v2::DNCGlobal const d);
 
-	//returns a reference to the correct reticle
+	//returns a reference to the correct reticle, valid as long as the reticle has an owner
 	facets::ReticleControl& get_reticle(halco::hicann::v2::DNCGlobal const d);
 
-	//returns a reference to the correct reticle
+	//returns a reference to the correct reticle, which has to be owned by f
 	facets::ReticleControl& get_reticle(Handle::FPGAHw const& f, halco::hicann::v2::DNCOnFPGA const d);
 
-	//returns a reference to one of the reticles that a FPGA f handles
+	//returns a reference to one of the reticles that a FPGA f owns
 	facets::ReticleControl& get_some_reticle(Handle::FPGAHw const& f);
 
-	//switches reticle off and deletes it. returns true on success
-	//must be implemented later because all HICANNBackends of the reticle
-	//have to be deleted beforehand and this is not yet possible (stateless)
-	// TODO: fix descriptions (ECM)
-	void destroy_reticle(halco::hicann::v2::DNCGlobal const d);
+	//releases the reticle owned by f, the reticle is switched off and deleted
+	//along with its last owner. All HICANN handles of the reticle have to be
+	//deleted beforehand.
+	void destroy_reticle(Handle::FPGAHw const& f, halco::hicann::v2::DNCGlobal const d);
+
+	//returns the JTAG clock frequency the reticle was set up with
+	halco::hicann::v2::JTAGFrequency jtag_frequency(halco::hicann::v2::DNCGlobal const d) const;
 
 	//converts HICANN coordinate in JTAG-relevant reticle-intern HICANN number
 	uint8_t hicann_jtag_addr(halco::hicann::v2::HICANNGlobal const& h);
@@ -75,22 +114,35 @@ struct PowerBackend {
 	/// returns a reference to the Host Application Layer for the given FPGA.
 	HostALController& get_host_al(Handle::FPGAHw const& f);
 
-	// as unique_ptr calls it...
+	// as shared_ptr calls it...
 	~PowerBackend();
 
+	/// number of reticles currently instantiated
+	size_t size() const;
+
 protected:
 	PowerBackend();
 
-	// LUT to assign jtag index to hs channel index
-	std::map<unsigned int, unsigned int> hs2jtag_lut;
-
 private:
 	PowerBackend(PowerBackend const &) = delete;
 
+	// returns the reticle of d or nullptr, requires m_mutex to be locked
+	Reticle const* find(halco::hicann::v2::DNCGlobal const d) const;
+	// as above, additionally requires the reticle to be owned by f
+	Reticle const* find(Handle::FPGAHw const& f, halco::hicann::v2::DNCGlobal const d) const;
+
+	container_type all_reticles;
+	// enum values of the DNCGlobals of reticles being connected to, cf. SetupReticle
+	std::unordered_set<size_t> m_pending;
+	mutable std::mutex m_mutex;
+	// notified whenever a reticle leaves m_pending
+	std::condition_variable m_setup_done;
+
 	friend class ::HMF::Handle::FPGAHw;
+	// sets up the reticle with f as owner, adds f to the owners if the reticle already exists
 	void SetupReticle(
+	    Handle::FPGAHw const& f,
 	    halco::hicann::v2::DNCGlobal const d,
-	    halco::hicann::v2::IPv4 fpga_ip,
 	    uint16_t jtag_port,
 	    halco::hicann::v2::IPv4 pmu_ip,
 	    std::set<halco::hicann::v2::HICANNOnDNC> physically_available_hicanns,
@@ -0,0 +1,94 @@
+#include "hal/Handle/dump/binary_dump.h"
+
+#include <stdexcept>
+
+namespace HMF {
+namespace Handle {
+
+BinaryDumpReader::BinaryDumpReader(std::string const& filename) :
+	m_file(filename, std::ios::binary)
+{
+	if (!m_file)
+		throw std::runtime_error("cannot open binary dump " + filename);
+
+	std::ifstream index(filename + binary_dump::index_suffix, std::ios::binary | std::ios::ate);
+	if (index) {
+		m_index.resize(index.tellg() / sizeof(binary_dump::IndexEntry));
+		index.seekg(0);
+		index.read(
+		    reinterpret_cast<char*>(m_index.data()),
+		    m_index.size() * sizeof(binary_dump::IndexEntry));
+	}
+
+	m_file.seekg(0, std::ios::end);
+	std::uint64_t const file_size = m_file.tellg();
+	// index is missing or does not cover the dump, e.g. after a crash
+	if (!index ||
+	    (m_index.empty() ? file_size != 0
+	                     : m_index.back().offset + m_index.back().size != file_size)) {
+		scan();
+	}
+}
+
+void BinaryDumpReader::scan()
+{
+	m_index.clear();
+	m_file.clear();
+	m_file.seekg(0);
+
+	binary_dump::RecordHeader header;
+	std::uint64_t offset = 0;
+	while (m_file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+		if (header.magic != binary_dump::record_magic)
+			throw std::runtime_error(
+			    "binary dump corrupted at offset " + std::to_string(offset));
+		std::uint64_t const size = sizeof(header) + header.name_size + header.payload_size;
+		m_index.push_back({offset, size});
+		offset += size;
+		m_file.seekg(offset);
+	}
+	// a truncated last record gets dropped
+	m_file.clear();
+	m_file.seekg(0, std::ios::end);
+	if (!m_index.empty() && m_index.back().offset + m_index.back().size >
+	                            static_cast<std::uint64_t>(m_file.tellg()))
+		m_index.pop_back();
+}
+
+size_t BinaryDumpReader::size() const
+{
+	return m_index.size();
+}
+
+binary_dump::RecordHeader BinaryDumpReader::read_header(size_t const call) const
+{
+	binary_dump::RecordHeader header;
+	m_file.clear();
+	m_file.seekg(m_index.at(call).offset);
+	m_file.read(reinterpret_cast<char*>(&header), sizeof(header));
+	if (!m_file || header.magic != binary_dump::record_magic)
+		throw std::runtime_error("binary dump corrupted at call " + std::to_string(call));
+	return header;
+}
+
+std::string BinaryDumpReader::name(size_t const call) const
+{
+	auto const header = read_header(call);
+	std::string name(header.name_size, '\0');
+	m_file.read(&name[0], name.size());
+	return name;
+}
+
+std::string BinaryDumpReader::payload(size_t const call) const
+{
+	auto const header = read_header(call);
+	std::string payload(header.payload_size, '\0');
+	m_file.seekg(header.name_size, std::ios::cur);
+	m_file.read(&payload[0], payload.size());
+	if (!m_file)
+		throw std::runtime_error("binary dump truncated at call " + std::to_string(call));
+	return payload;
+}
+
+} // namespace Handle
+} // namespace HMF
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
+
+#include "hal/Handle/dump/dump_helper.h"
+
+namespace HMF {
+namespace Handle {
+
+/**
+ * Layout of binary dumps, cf. Dump::enableBinaryDump.
+ *
+ * A dump is a sequence of records, one per call.  Each record consists of a
+ * RecordHeader, the name of the called function and the payload, i.e. the
+ * coordinate of the handle and the arguments serialized into a boost binary
+ * archive (without archive header).  As every call is an archive of its own,
+ * calls can be deserialized independently of each other.
+ *
+ * For each record an IndexEntry is appended to a separate index file
+ * (filename + index_suffix), allowing random access without scanning the dump.
+ */
+namespace binary_dump {
+
+/// Marks the begin of each record
+static std::uint32_t const record_magic = 0x48444d50; // "HDMP"
+
+/// Suffix of the index file
+static char const* const index_suffix = ".index";
+
+struct RecordHeader
+{
+	std::uint32_t magic;
+	std::uint32_t name_size;
+	std::uint64_t payload_size;
+};
+
+struct IndexEntry
+{
+	/// Offset of the RecordHeader in the dump
+	std::uint64_t offset;
+	/// Size of the whole record, including header and name
+	std::uint64_t size;
+};
+
+static_assert(sizeof(RecordHeader) == 16, "unexpected size of binary dump record header");
+static_assert(sizeof(IndexEntry) == 16, "unexpected size of binary dump index entry");
+
+} // namespace binary_dump
+
+/**
+ * Lazy reader of binary dumps.
+ *
+ * Opening a dump only reads the index (or, if there is none, scans the record
+ * headers).  Names and payloads of calls are read on demand and payloads are
+ * deserialized only if requested via load(), hence single calls of large dumps
+ * can be inspected or replayed cheaply.
+ *
+ * @note Binary archives are not portable, dumps have to be read on the same
+ *       architecture and with the same boost version as they were written.
+ */
+class BinaryDumpReader
+{
+public:
+	explicit BinaryDumpReader(std::string const& filename);
+
+	/// Number of calls in the dump
+	size_t size() const;
+
+	/// Name of the called function
+	std::string name(size_t call) const;
+
+	/// Raw payload, i.e. the binary archive of coordinate and arguments
+	std::string payload(size_t call) const;
+
+	/**
+	 * Deserializes the coordinate of the handle and the arguments of a call.
+	 *
+	 * The types of args have to match the ones of the dumped function (cf. name()),
+	 * e.g. for a HICANN setter a HICANNGlobal followed by all non-handle arguments.
+	 */
+	template <typename... Args>
+	void load(size_t call, Args&... args) const;
+
+private:
+	binary_dump::RecordHeader read_header(size_t call) const;
+	void scan();
+
+	mutable std::ifstream m_file;
+	std::vector<binary_dump::IndexEntry> m_index;
+};
+
+
+template <typename... Args>
+void BinaryDumpReader::load(size_t const call, Args&... args) const
+{
+	std::string const data = payload(call);
+	boost::iostreams::stream<boost::iostreams::array_source> stream(data.data(), data.size());
+	boost::archive::binary_iarchive archive(stream, boost::archive::no_header);
+	dump_helper(archive, args...);
+}
+
+} // namespace Handle
+} // namespace HMF
@@ -10,18 +10,27 @@
 std::string
 string_replace(std::string const& str, std::string const& what, std::string const& with);
 
+/// Returns the type name of T usable as XML tag, it is only computed once per type.
+template<typename T>
+std::string const& dump_type_name() {
+	static std::string const name = [] {
+		std::string name = ZTL::typestring<T>();
+		name = string_replace(name, "::", ".");
+		name = string_replace(name, " ", "_");
+		name = string_replace(name, ",", "-");
+		name = string_replace(name, "<", "_LT_");
+		name = string_replace(name, ">", "_GT_");
+		return name;
+	}();
+	return name;
+}
+
 template<typename Archive>
 void dump_helper(Archive&) {}
 
 template<typename Archive, typename Arg, typename ... Args>
 void dump_helper(Archive& ar, Arg & arg, Args & ... args) {
 	using namespace boost::serialization;
-	std::string name = ZTL::typestring<typename std::decay<Arg>::type>();
-	name = string_replace(name, "::", ".");
-	name = string_replace(name, " ", "_");
-	name = string_replace(name, ",", "-");
-	name = string_replace(name, "<", "_LT_");
-	name = string_replace(name, ">", "_GT_");
-	ar & make_nvp(name.c_str(), arg);
+	ar & make_nvp(dump_type_name<typename std::decay<Arg>::type>().c_str(), arg);
 	dump_helper(ar, args...);
 }
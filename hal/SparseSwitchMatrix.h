@@ -2,11 +2,17 @@
 
 #include <boost/serialization/nvp.hpp>
 #include <boost/serialization/serialization.hpp>
+#include <boost/serialization/split_member.hpp>
+#include <bitset>
 #include <cassert>
+#include <climits>
+#include <cstdint>
 #include <iomanip>
 #include <ostream>
 #include <string>
 #include <sstream>
+#include <stdexcept>
+#include <type_traits>
 
 #include "pywrap/compat/array.hpp"
 #include "pywrap/compat/debug.hpp"
@@ -52,8 +58,8 @@ public:
 	/**
 	 * @brief returns an array containing all valid x coordinates for given @param y
 	 *
-	 * @note This can be implemented / shadowed in Derived using arithmetic
-	 *		 to provide better performance.
+	 * @note Answered from a table generated at compile time from
+	 *       Derived::exists_enum (cf. lines_table).
 	 */
 	static x_lines_type get_lines(y_type const& y);
 
@@ -94,24 +100,59 @@ public:
 	}
 
 protected:
-	// TODO: in next release `row_type` could become bitset
-	typedef std::array<value_type, periods * period_length> row_type;
-	typedef std::array<row_type, y_type::end>               matrix_type;
+	/// bit-packed switches of a row, indexed by position (cf. index)
+	typedef std::bitset<periods * period_length> row_type;
+	typedef std::array<row_type, y_type::end>    matrix_type;
+
+	/// enum value of the x coordinate of each position of each row (cf. index)
+	typedef std::array<std::array<uint16_t, periods * period_length>, y_type::end>
+		lines_table_type;
+	/// number of enabled switches per x coordinate
+	typedef std::array<size_t, x_type::end>       column_counts_type;
 
 	matrix_type&       switches();
 	matrix_type const& switches() const;
 
-	value_type&       _get(x_type x, y_type y);
-	value_type const& _get(x_type x, y_type y) const;
+	/**
+	 * @brief position of switch (x, y) within its row
+	 * @throws InvalidSwitch if the switch does not exist
+	 */
+	static size_t index(x_type x, y_type y);
+
+	static PYPP_CONSTEXPR lines_table_type make_lines_table();
+	static lines_table_type const& lines_table();
+
+	/// counts the enabled switches of each column by visiting the enabled switches only
+	column_counts_type count_columns() const;
+
+	/// reads rsp. writes row.size() consecutive switches of row y starting at position offset
+	template <typename Row>
+	Row get_bits(y_type y, size_t offset) const;
+	template <typename Row>
+	void set_bits(y_type y, size_t offset, Row const& row);
 
 private:
+	static_assert(std::is_same<value_type, bool>::value, "switches are stored as bits");
+	static_assert(periods * period_length <= sizeof(unsigned long) * CHAR_BIT,
+	              "rows have to fit into unsigned long, cf. count_columns");
+
+	/// position within its row, not checking whether the switch exists
+	static PYPP_CONSTEXPR size_t position(size_t x);
+
+	/// layout of the former std::array<bool> storage, kept for serialization
+	typedef std::array<std::array<value_type, periods * period_length>, y_type::end>
+		unpacked_matrix_type;
+
 	matrix_type mSwitches;
 
 	//template<typename T> friend class Backend;
 
 	friend class boost::serialization::access;
 	template<typename Archiver>
-	void serialize(Archiver& ar, unsigned int const);
+	void save(Archiver& ar, unsigned int const) const;
+	template<typename Archiver>
+	void load(Archiver& ar, unsigned int const);
+	BOOST_SERIALIZATION_SPLIT_MEMBER()
 };
 
 } // HMF
@@ -140,32 +181,24 @@ SPARSE_SWITCH_HEADER
 typename SPARSE_SWITCH_TYPE::value_type
 SPARSE_SWITCH_TYPE::get(x_type x, y_type y) const
 {
-	return _get(x, y);
+	return mSwitches[y][index(x, y)];
 }
 
 SPARSE_SWITCH_HEADER
 void SPARSE_SWITCH_TYPE::set(x_type x, y_type y, value_type v)
 {
-	_get(x, y) = v;
+	mSwitches[y][index(x, y)] = v;
 }
 
 SPARSE_SWITCH_HEADER
 typename SPARSE_SWITCH_TYPE::x_lines_type
 SPARSE_SWITCH_TYPE::get_lines(y_type const& y)
 {
-	size_t idx = 0;
 	x_lines_type lines;
-
-	for (size_t ii = 0; ii < x_type::end; ++ii)
-	{
-		x_type x(ii);
-		if (exists(x, y)) {
-			lines[idx++] = x;
-		}
+	auto const& row = lines_table()[y];
+	for (size_t idx = 0; idx < lines.size(); ++idx) {
+		lines[idx] = x_type(row[idx]);
 	}
-
-	assert(idx == lines.size());
-
 	return lines;
 }
 
@@ -202,40 +235,121 @@ SPARSE_SWITCH_TYPE::switches() const
 }
 
 SPARSE_SWITCH_HEADER
-typename SPARSE_SWITCH_TYPE::value_type&
-SPARSE_SWITCH_TYPE::_get(x_type x, y_type y)
+PYPP_CONSTEXPR size_t SPARSE_SWITCH_TYPE::position(size_t x)
 {
-	SparseSwitchMatrix const& This = *this;
-	return const_cast<value_type&>(This._get(x, y));
+	return x/(x_type::end/periods)*period_length + x%period_length;
 }
 
 SPARSE_SWITCH_HEADER
-typename SPARSE_SWITCH_TYPE::value_type const&
-SPARSE_SWITCH_TYPE::_get(x_type x, y_type y) const
+size_t SPARSE_SWITCH_TYPE::index(x_type x, y_type y)
 {
 	if (!exists(x, y)) {
 		throw InvalidSwitch<x_type, y_type>(x, y);
 	}
-	return switches()[y][x/(x_type::end/periods)*period_length + x%period_length];
+	return position(x);
+}
+
+SPARSE_SWITCH_HEADER
+PYPP_CONSTEXPR typename SPARSE_SWITCH_TYPE::lines_table_type
+SPARSE_SWITCH_TYPE::make_lines_table()
+{
+	// positions are increasing in x, i.e. each row lists its lines in ascending order
+	lines_table_type table{};
+	for (size_t yy = 0; yy < y_type::end; ++yy) {
+		size_t count = 0;
+		for (size_t xx = 0; xx < x_type::end; ++xx) {
+			if (Derived::exists_enum(xx, yy)) {
+				table[yy][position(xx)] = static_cast<uint16_t>(xx);
+				++count;
+			}
+		}
+		if (count != periods * period_length) {
+			throw std::logic_error("SparseSwitchMatrix: wrong number of switches per row");
+		}
+	}
+	return table;
+}
+
+SPARSE_SWITCH_HEADER
+typename SPARSE_SWITCH_TYPE::lines_table_type const&
+SPARSE_SWITCH_TYPE::lines_table()
+{
+	static PYPP_CONSTEXPR lines_table_type const table = make_lines_table();
+	return table;
+}
+
+SPARSE_SWITCH_HEADER
+typename SPARSE_SWITCH_TYPE::column_counts_type
+SPARSE_SWITCH_TYPE::count_columns() const
+{
+	column_counts_type counts{};
+	lines_table_type const& lines = lines_table();
+	for (size_t yy = 0; yy < y_type::end; ++yy) {
+		// typically only few switches are enabled: skip to the set bits
+		size_t idx = 0;
+		for (unsigned long bits = mSwitches[yy].to_ulong(); bits; bits >>= 1, ++idx) {
+			if (bits & 1) {
+				++counts[lines[yy][idx]];
+			}
+		}
+	}
+	return counts;
+}
+
+SPARSE_SWITCH_HEADER
+template <typename Row>
+Row SPARSE_SWITCH_TYPE::get_bits(y_type y, size_t offset) const
+{
+	Row row;
+	for (size_t ii = 0; ii < row.size(); ++ii) {
+		row[ii] = mSwitches[y][offset + ii];
+	}
+	return row;
+}
+
+SPARSE_SWITCH_HEADER
+template <typename Row>
+void SPARSE_SWITCH_TYPE::set_bits(y_type y, size_t offset, Row const& row)
+{
+	for (size_t ii = 0; ii < row.size(); ++ii) {
+		mSwitches[y][offset + ii] = row[ii];
+	}
 }
 
 SPARSE_SWITCH_HEADER
 void
 SPARSE_SWITCH_TYPE::clear()
 {
-#ifndef PYPLUSPLUS
 	for (auto & row : mSwitches)
 	{
-		std::fill(row.begin(), row.end(), value_type());
+		row.reset();
 	}
-#endif
 }
 
 SPARSE_SWITCH_HEADER
 template<typename Archiver>
-void SPARSE_SWITCH_TYPE::serialize(Archiver& ar, unsigned int const)
+void SPARSE_SWITCH_TYPE::save(Archiver& ar, unsigned int const) const
 {
-	ar & boost::serialization::make_nvp("switches", mSwitches);
+	unpacked_matrix_type switches;
+	for (size_t yy = 0; yy < y_type::end; ++yy) {
+		for (size_t ii = 0; ii < periods * period_length; ++ii) {
+			switches[yy][ii] = mSwitches[yy][ii];
+		}
+	}
+	ar << boost::serialization::make_nvp("switches", switches);
+}
+
+SPARSE_SWITCH_HEADER
+template<typename Archiver>
+void SPARSE_SWITCH_TYPE::load(Archiver& ar, unsigned int const)
+{
+	unpacked_matrix_type switches;
+	ar >> boost::serialization::make_nvp("switches", switches);
+	for (size_t yy = 0; yy < y_type::end; ++yy) {
+		for (size_t ii = 0; ii < periods * period_length; ++ii) {
+			mSwitches[yy][ii] = switches[yy][ii];
+		}
+	}
 }
 
 SPARSE_SWITCH_HEADER
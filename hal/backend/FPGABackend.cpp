@@ -1,7 +1,10 @@
 #include "FPGABackend.h"
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <mutex>
 #include <sstream>
 #include <thread>
 
@@ -11,6 +14,7 @@
 #include "halco/common/iter_all.h"
 #include "hal/backend/DNCBackend.h"
 #include "hal/backend/FPGABackendHelper.h"
+#include "hal/backend/FPGATraceDecoder.h"
 #include "hal/backend/HICANNBackendHelper.h"
 #include "hal/backend/dispatch.h"
 #include "sctrltp/ARQStream.h"
@@ -168,6 +172,9 @@ HALBE_SETTER(
 				for (auto h : halco::common::iter_all<halco::hicann::v2::HICANNOnDNC>()) {
 					if (f.hicann_active(d, h)) {
 						HICANN::set_PLL_multiplier(*f.get(d, h), PLL_divisior, PLL_multiplier);
+						// the design reset discards the configuration of the HICANN
+						if (auto hw = boost::dynamic_pointer_cast<Handle::HICANNHw>(f.get(d, h)))
+							hw->shadow_state().clear();
 					}
 				}
 			}
@@ -406,15 +413,12 @@ HALBE_SETTER(
 		bg.rate, bg.seed, bg.first_address, bg.last_address, hc);
 }
 
-// TODO: uint16_t is ugly!
-HALBE_SETTER(
-	write_playback_program,
-	Handle::FPGA &, f,
-	PulseEventContainer const&, st,
-	PulseEvent::spiketime_t, runtime,
-	uint16_t, fpga_hicann_delay,
-	bool, enable_trace_recording,
-	bool, drop_background_events)
+namespace {
+
+void begin_playback_program(
+	Handle::FPGAHw& f,
+	bool const enable_trace_recording,
+	bool const drop_background_events)
 {
 	HostALController& host_al = f.getPowerBackend().get_host_al(f);
 	ReticleControl& reticle = f.getPowerBackend().get_reticle(f, halco::hicann::v2::DNCOnFPGA());
@@ -428,20 +432,14 @@ HALBE_SETTER(
 	host_al.addPlaybackFPGAConfig(
 	    0 /*time*/, false /*end_mark*/, false /*stop trace*/, false /*start trace read*/,
 	    !enable_trace_recording /*block trace recording*/);
+}
 
-	size_t const npulses = st.size();
-	uint64_t last_fpga_time = 0;
-	for (size_t n = 0; n < npulses; ++n) {
-		PulseEvent pe = st[n];
-		if (pe.getTime() < fpga_hicann_delay*2)
-			throw std::runtime_error(
-				"write_playback_program: the time of the PulseEvent in the spike "
-				"list has to be greater or equal than fpga_hicann_delay*2");
-		last_fpga_time = pe.getTime()/2 - fpga_hicann_delay;
-		uint16_t id =  pe.getLabel();
-		// FIXME: add check for highspeed-capable HICANN here (encoded in id) issue #2995
-		host_al.addPlaybackPulse(last_fpga_time, /*uint16_t hicann_time*/ pe.getTime(), id);
-	}
+void end_playback_program(
+	Handle::FPGAHw& f,
+	PulseEvent::spiketime_t const runtime,
+	uint64_t const last_fpga_time)
+{
+	HostALController& host_al = f.getPowerBackend().get_host_al(f);
 
 	// Calculate EoE timestamp in FPGA clock cycles, devide by two as DNC frequency == 2 * FPGA frequency
 	size_t end_of_experiment_timestamp = (runtime + 1) / 2;
@@ -457,6 +455,119 @@ HALBE_SETTER(
 		throw std::runtime_error("write_playback_program: failed to send pulse packets to FPGA");
 }
 
+/// Pulse as handed to HostALController::addPlaybackPulse.
+struct PlaybackEntry
+{
+	uint64_t fpga_time;
+	PulseEvent::spiketime_t hicann_time;
+	uint16_t id;
+};
+
+PlaybackEntry to_playback_entry(PulseEvent const& pe, uint16_t const fpga_hicann_delay)
+{
+	if (pe.getTime() < fpga_hicann_delay*2)
+		throw std::runtime_error(
+			"write_playback_program: the time of the PulseEvent in the spike "
+			"list has to be greater or equal than fpga_hicann_delay*2");
+	// FIXME: add check for highspeed-capable HICANN here (encoded in id) issue #2995
+	return PlaybackEntry{pe.getTime()/2 - fpga_hicann_delay, pe.getTime(), pe.getLabel()};
+}
+
+} // namespace
+
+// TODO: uint16_t is ugly!
+HALBE_SETTER(
+	write_playback_program,
+	Handle::FPGA &, f,
+	PulseEventContainer const&, st,
+	PulseEvent::spiketime_t, runtime,
+	uint16_t, fpga_hicann_delay,
+	bool, enable_trace_recording,
+	bool, drop_background_events)
+{
+	HostALController& host_al = f.getPowerBackend().get_host_al(f);
+	begin_playback_program(f, enable_trace_recording, drop_background_events);
+
+	size_t const npulses = st.size();
+	uint64_t last_fpga_time = 0;
+	for (size_t n = 0; n < npulses; ++n) {
+		PlaybackEntry const entry = to_playback_entry(st[n], fpga_hicann_delay);
+		last_fpga_time = entry.fpga_time;
+		host_al.addPlaybackPulse(entry.fpga_time, /*uint16_t hicann_time*/ entry.hicann_time, entry.id);
+	}
+
+	end_playback_program(f, runtime, last_fpga_time);
+}
+
+double PlaybackUploadStatistics::pulses_per_second() const
+{
+	if (duration.count() == 0) {
+		return 0.;
+	}
+	return pulses_uploaded / std::chrono::duration<double>(duration).count();
+}
+
+PlaybackUploadStatistics write_playback_program_chunked(
+	Handle::FPGA& f,
+	PulseEventContainer const& st,
+	PulseEvent::spiketime_t const runtime,
+	uint16_t const fpga_hicann_delay,
+	bool const enable_trace_recording,
+	bool const drop_background_events,
+	size_t const chunk_size,
+	playback_progress_type const& progress)
+{
+	if (chunk_size == 0) {
+		throw std::invalid_argument("write_playback_program_chunked: chunk size has to be non-zero");
+	}
+
+	auto const start = std::chrono::steady_clock::now();
+	PlaybackUploadStatistics statistics{st.size(), 0, std::chrono::microseconds{0}};
+
+	auto const report = [&]() {
+		statistics.duration = std::chrono::duration_cast<std::chrono::microseconds>(
+		    std::chrono::steady_clock::now() - start);
+		if (progress) {
+			progress(statistics);
+		}
+	};
+
+	if (handle_kind(f) != HandleKind::hardware) {
+		write_playback_program(
+		    f, st, runtime, fpga_hicann_delay, enable_trace_recording, drop_background_events);
+		statistics.pulses_uploaded = st.size();
+		report();
+		return statistics;
+	}
+
+	auto* const fh = handle_cast<Handle::FPGAHw>(f);
+	HostALController& host_al = fh->getPowerBackend().get_host_al(*fh);
+	begin_playback_program(*fh, enable_trace_recording, drop_background_events);
+
+	uint64_t last_fpga_time = 0;
+	for (size_t begin = 0; begin < st.size(); begin += chunk_size) {
+		size_t const end = std::min(begin + chunk_size, st.size());
+		for (size_t n = begin; n < end; ++n) {
+			PlaybackEntry const entry = to_playback_entry(st[n], fpga_hicann_delay);
+			last_fpga_time = entry.fpga_time;
+			host_al.addPlaybackPulse(entry.fpga_time, /*uint16_t hicann_time*/ entry.hicann_time, entry.id);
+		}
+		statistics.pulses_uploaded = end;
+		report();
+	}
+
+	end_playback_program(*fh, runtime, last_fpga_time);
+
+	statistics.duration = std::chrono::duration_cast<std::chrono::microseconds>(
+	    std::chrono::steady_clock::now() - start);
+	LOG4CXX_DEBUG(
+	    logger, halco::hicann::v2::short_format(fh->coordinate())
+	                << " uploaded " << statistics.pulses_uploaded << " pulses in "
+	                << statistics.duration.count() << " us ("
+	                << statistics.pulses_per_second() << " pulses/s)");
+	return statistics;
+}
+
 HALBE_GETTER(bool, get_pbmem_buffering_completed,
 	Handle::FPGA &, f
 	)
@@ -465,74 +576,36 @@ HALBE_GETTER(bool, get_pbmem_buffering_completed,
 	return (host_al.getPlaybackEndAddress() != 0);
 }
 
-HALBE_GETTER(PulseEventContainer::container_type, read_trace_pulses,
-	Handle::FPGA &, f,
-	PulseEvent::spiketime_t const, runtime)
+namespace {
+
+/**
+ * Receives and decodes FPGA trace packets until the end-of-trace marker arrives.
+ *
+ * Decoded pulse events are appended to pulse_events.  After each decoded packet
+ * on_poll(false) is called, after each polling round without new data
+ * on_poll(true).  This allows the caller to hand out (and remove) events while
+ * the trace is still being received.
+ */
+template <typename PollHandler>
+void receive_trace_pulses(
+	Handle::FPGAHw& f,
+	PulseEvent::spiketime_t const runtime,
+	PulseEventContainer::container_type& pulse_events,
+	PollHandler&& on_poll)
 {
-	// We have to handle all possible types of packets described in section
-	// "I-10.2.1. FPGA Trace / Pulse Data" of the specification, i.e. pulse
-	// entries and overflow indicators.
-
-	// Each 64 bit packet consists of two entries aligned to 32 bit.
+	HostALController& host_al = f.getPowerBackend().get_host_al(f);
+	unsigned int sleep_duration_in_us = 500;
 
-	constexpr size_t EVENT_TIMESTAMP_BITS = 15;
-	union entry_type
-	{
-		std::uint32_t raw;
-		// A pulse event is indicated by two '0' high-order bits.  The sequence '01'
-		// is used to mark the absence of a pulse event in a packet that contains an
-		// overflow indicator.
-		struct
-		{
-			// LSBs of pulse event timestamp, MSBs are transmitted via overflow indicators.
-			unsigned int timestamp : EVENT_TIMESTAMP_BITS;
-			// Label of pulse event, as described below.
-			unsigned int label : 12;
-			unsigned int : 2; // padding
-			// MSB of the FPGA systime counter.
-			unsigned int fpga_msb : 1;
-			// Two zero-bits, to encode entry type.
-			unsigned int zero_bits : 2;
-		} event;
-		// An overflow indicator is indicated by a '1' high-order bit.
-		struct
-		{
-			unsigned int count : 31;
-			unsigned int is_overflow : 1;
-		} overflow;
-	};
+	sctrltp::ARQStream<sctrltp::ParametersFcpBss1>* const arq_ptr = host_al.getARQStream();
 
-	// A pulse event label consists of 12 bit used as follows:
-	// |     3bit    |   3bit   |    6bit   |
-	// | HICANNOnDNC | GbitLink | L1Address |
-	// Each pulse label will be converted to a 16 bit PulseAddress,
-	// where the additional 4 bit remain unused.
-
-	// Count the number of overflow indicators to calculate MSBs of full time stamp.
-	std::uint64_t trace_overflow_count = 0;
-	constexpr std::uint64_t MAX_TIMESTAMP_CNT = 1 << EVENT_TIMESTAMP_BITS;
-
-	bool const trace_enabled = logger->isTraceEnabled();
-#define HALBE_RTP_TRACE(message) \
-	{ \
-		if (LOG4CXX_UNLIKELY(trace_enabled)) { \
-			::log4cxx::helpers::MessageBuffer oss_; \
-			logger->forcedLog( \
-			    ::log4cxx::Level::getTrace(), oss_.str(oss_ << message), LOG4CXX_LOCATION); \
-		} \
-	}
+	TraceDecoder decoder(f.coordinate());
 
-	PulseEventContainer::container_type pulse_events;
-	auto const receive_pulse_events =
-	    [trace_enabled, &pulse_events, &trace_overflow_count,
-	     &f](sctrltp::ARQStream<sctrltp::ParametersFcpBss1>* const arq_ptr)
-	    -> std::tuple<bool, std::uint64_t> {
-		bool received_eot = false;
+	auto const receive_pulse_events = [&decoder, &pulse_events, &f, &on_poll, arq_ptr]() -> std::uint64_t {
 		std::uint64_t received_pulse_events_count = 0;
 		// FIXME@ECM: defined in hicann-system/…/ARQFrame.h (no namespace)
 		sctrltp::packet<sctrltp::ParametersFcpBss1> current_packet;
-		while ((!received_eot) && arq_ptr->receive(current_packet)) {
-			HALBE_RTP_TRACE("received hostARQ packet with " << current_packet.len << " entries");
+		while ((!decoder.received_end_of_trace()) && arq_ptr->receive(current_packet)) {
+			LOG4CXX_TRACE(logger, "received hostARQ packet with " << current_packet.len << " entries");
 			if (BOOST_UNLIKELY(current_packet.pid !=
 			                   application_layer_packet_types::FPGATRACE)) {
 				LOG4CXX_ERROR(logger,
@@ -546,142 +619,15 @@ HALBE_GETTER(PulseEventContainer::container_type, read_trace_pulses,
 #if defined(__GNUC__) && (__GNUC__ >= 9)
 #pragma GCC diagnostic ignored "-Waddress-of-packed-member"
 #endif
-			entry_type* const entries = reinterpret_cast<entry_type*>(current_packet.pdu);
+			std::uint64_t const* const pdu = current_packet.pdu;
 #pragma GCC diagnostic pop
 
-			for (std::uint16_t ii = 0; ii < 2 * current_packet.len; ++ii) {
-
-				// check for end-of-trace marker every 64-bit word
-				if ((ii % 2) == 0) {
-					if (current_packet.pdu[ii/2] == 0x4000E11D40000000ull) {
-						if (((ii/2) + 1) < current_packet.len) {
-							std::stringstream debug_msg;
-							debug_msg << halco::hicann::v2::short_format(f.coordinate())
-							          << " unexpected end-of-trace marker"
-							             " within other data: " << ii / 2 << " out of "
-							          << (current_packet.len - 1) << ".\n"
-							          << " Next entry looks like: " << std::hex
-							          << current_packet.pdu[(ii / 2) + 1] << std::dec
-							          << "\n";
-							LOG4CXX_ERROR(logger, debug_msg.str());
-							std::runtime_error(debug_msg.str());
-						}
-						// packet handling done, bail out
-						received_eot = true;
-						break;
-					}
-				}
-
-				// non-eot data handling below
-				auto const& entry = entries[ii];
-
-				if (entry.overflow.is_overflow) {
-					if (BOOST_UNLIKELY(ii % 2 != 1)) {
-#ifndef NDEBUG
-						// Overflow entries should only occur at odd indices.
-						LOG4CXX_WARN(logger,
-						             halco::hicann::v2::short_format(f.coordinate())
-						                 << " garbage overflow entry at even index " << ii
-						                 << ": " << std::showbase << std::hex << entry.raw
-						                 << " (issue 2355)");
-#endif // !NDEBUG
-						continue;
-					}
-					trace_overflow_count += 1;
-
-#ifndef NDEBUG
-					HALBE_RTP_TRACE(
-						"overflow packet " << trace_overflow_count
-						<< std::showbase
-						<< " with value " << std::hex << entry.overflow.count
-						<< " (" << std::dec << entry.overflow.count << ")" << " received.\n"
-						<< " current offset is " << std::hex << trace_overflow_count * MAX_TIMESTAMP_CNT
-						<< " (" << std::dec << trace_overflow_count * MAX_TIMESTAMP_CNT << ")");
-
-					if (trace_overflow_count != entry.overflow.count) {
-						LOG4CXX_WARN(
-						    logger,
-						    halco::hicann::v2::short_format(f.coordinate())
-						        << " Local overflow count " << trace_overflow_count
-						        << " does not match contents of overflow indicator "
-						        << entry.overflow.count);
-					}
-#endif // !NDEBUG
-
-					continue;
-				} else if (entry.event.zero_bits != 0) {
-					// no overflow, no spike => garbage
-					continue;
-				}
-
-				std::uint64_t full_timestamp =
-					static_cast<std::uint64_t>(entry.event.timestamp) +
-					trace_overflow_count * MAX_TIMESTAMP_CNT;
-				bool timestamp_msb = entry.event.timestamp >> (EVENT_TIMESTAMP_BITS - 1);
-
-				// Detect special case that HICANN timestamp was registered before
-				// overflow, but pulse arrives in FPGA after overflow and an overflow
-				// packet was generated.
-				if (timestamp_msb && !entry.event.fpga_msb) {
-					if (full_timestamp < MAX_TIMESTAMP_CNT) {
-						// Ignore early pulses.
-						continue;
-					}
-					// Undo last overflow for that pulse.
-					full_timestamp -= MAX_TIMESTAMP_CNT;
-				}
-
-#ifndef NDEBUG
-				HALBE_RTP_TRACE(
-					"received pulse event " << received_pulse_events_count << " (entry " << ii << "):\n"
-					<< std::showbase
-					<< "id: " << std::hex << entry.event.label << ", "
-					<< "timestamp: " << std::hex << entry.event.timestamp
-					<< " (" << std::dec << entry.event.timestamp << ")" << ", "
-					<< "msb timestamp/fpga: " << timestamp_msb << "/" << entry.event.fpga_msb << ",\n"
-					<< "full timestamp: " << std::hex << full_timestamp
-					<< " (" << std::dec << full_timestamp << ")");
-
-				if (!pulse_events.empty()) {
-					auto const& last_event = pulse_events.back();
-
-					// Old bug where trace memory potentially stored pulse twice while
-					// sending overflow packet, should not occur anymore.
-					// TODO 2016-04-27: Remove check when it's absolutely sure that the bug is
-					// fixed.
-					if (last_event.getLabel() == entry.event.label &&
-					    (last_event.getTime() == full_timestamp ||
-					     (last_event.getTime() + MAX_TIMESTAMP_CNT) == full_timestamp)) {
-						LOG4CXX_WARN(logger,
-						             halco::hicann::v2::short_format(f.coordinate())
-						                 << " received pulse twice (issue 2022): "
-						                 << pulse_events.back().getTime()
-						                 << " == " << full_timestamp << "\n(32 bit entry "
-						                 << ii << "/" << (2 * current_packet.len)
-						                 << " of ARQ frame, spike " << pulse_events.size()
-						                 << ") with label " << entry.event.label);
-					}
-				}
-#endif // !NDEBUG
-
-				// Update the count of received pulse events unconditionally, as it is
-				// used to decide when to timeout below.
-				++received_pulse_events_count;
-
-				pulse_events.push_back(
-					PulseEvent(PulseAddress(entry.event.label), full_timestamp));
-			}
+			received_pulse_events_count += decoder.decode(pdu, current_packet.len, pulse_events);
+			on_poll(false);
 		}
-		return std::make_tuple(received_eot, received_pulse_events_count);
+		return received_pulse_events_count;
 	}; // receive_pulse_events
 
-#undef HALBE_RTP_TRACE
-
-	HostALController& host_al = f.getPowerBackend().get_host_al(f);
-	unsigned int sleep_duration_in_us = 500;
-
-	sctrltp::ARQStream<sctrltp::ParametersFcpBss1>* const arq_ptr = host_al.getARQStream();
-
 	/* We read(receive) data until we see the end-of-trace marker packet.
 	 * However, as the connection might die at any time ("cable being pulled", whatever)
 	 * we cannot just block here but rather have a relaxed timeout as it will only
@@ -708,8 +654,7 @@ HALBE_GETTER(PulseEventContainer::container_type, read_trace_pulses,
 
 	auto time_of_last_packet = std::chrono::steady_clock::now();
 	auto now = time_of_last_packet;
-	bool received_eot = false;
-	while (!received_eot) {
+	while (!decoder.received_end_of_trace()) {
 		now = std::chrono::steady_clock::now();
 		if ((now - time_of_last_packet) > timeout) {
 			std::stringstream debug_msg;
@@ -720,8 +665,7 @@ HALBE_GETTER(PulseEventContainer::container_type, read_trace_pulses,
 			throw std::runtime_error(debug_msg.str());
 		}
 
-		std::uint64_t num_pulses;
-		std::tie(received_eot, num_pulses) = receive_pulse_events(arq_ptr);
+		std::uint64_t const num_pulses = receive_pulse_events();
 		if (num_pulses > 0) {
 			// initial timeout done, now set to default timeout
 			timeout  = default_timeout;
@@ -736,17 +680,167 @@ HALBE_GETTER(PulseEventContainer::container_type, read_trace_pulses,
 			continue;
 		}
 
+		if (decoder.received_end_of_trace()) {
+			break;
+		}
+
+		on_poll(true);
 		if ((usleep(sleep_duration_in_us) != 0) && (errno != EINTR)) {
 			throw std::runtime_error("usleep failed in read_trace_pulses");
 		}
 	}
 	LOG4CXX_INFO(
 	    logger, halco::hicann::v2::short_format(f.coordinate())
-	                << " received " << pulse_events.size() << " pulse events");
+	                << " received " << decoder.pulse_event_count() << " pulse events");
+}
+
+} // namespace
 
+HALBE_GETTER(PulseEventContainer::container_type, read_trace_pulses,
+	Handle::FPGA &, f,
+	PulseEvent::spiketime_t const, runtime)
+{
+	PulseEventContainer::container_type pulse_events;
+	receive_trace_pulses(f, runtime, pulse_events, [](bool) {});
 	return pulse_events;
 }
 
+PulseEventContainer::container_type read_trace_pulses_numpy(
+	Handle::FPGA& f, PulseEvent::spiketime_t const runtime)
+{
+	return read_trace_pulses(f, runtime);
+}
+
+void read_trace_pulses(
+	Handle::FPGA& f,
+	PulseEvent::spiketime_t const runtime,
+	trace_pulse_sink_type const& sink,
+	size_t const batch_size)
+{
+	if (!sink) {
+		throw std::invalid_argument("read_trace_pulses: invalid pulse event sink");
+	}
+	if (batch_size == 0) {
+		throw std::invalid_argument("read_trace_pulses: batch size has to be non-zero");
+	}
+
+	if (handle_kind(f) != HandleKind::hardware) {
+		// Non-hardware handles (dump, ESS) do not provide a trace stream: hand out
+		// the complete trace in batches after it has been read.
+		auto const pulse_events = read_trace_pulses(f, runtime);
+		for (size_t begin = 0; begin < pulse_events.size(); begin += batch_size) {
+			size_t const end = std::min(begin + batch_size, pulse_events.size());
+			sink(PulseEventContainer::container_type(
+			    pulse_events.begin() + begin, pulse_events.begin() + end));
+		}
+		return;
+	}
+
+	PulseEventContainer::container_type batch;
+	batch.reserve(batch_size);
+
+	// Hand out full batches as soon as they are available.  If the stream is
+	// idle, hand out what we have to keep the latency of the sink low.
+	auto const hand_out = [&batch, &sink, batch_size](bool const idle) {
+		if (batch.size() >= batch_size || (idle && !batch.empty())) {
+			sink(std::move(batch));
+			batch.clear();
+			batch.reserve(batch_size);
+		}
+	};
+	receive_trace_pulses(*fh, runtime, batch, hand_out);
+
+	if (!batch.empty()) {
+		sink(std::move(batch));
+	}
+}
+
+std::vector<TraceReadoutResult> read_trace_pulses(
+	std::vector<boost::shared_ptr<Handle::FPGA> > const& handles,
+	PulseEvent::spiketime_t const runtime,
+	size_t const num_threads)
+{
+	std::vector<TraceReadoutResult> results;
+	results.reserve(handles.size());
+	for (auto const& h : handles) {
+		results.push_back(TraceReadoutResult{
+		    h ? h->coordinate() : halco::hicann::v2::FPGAGlobal(), {},
+		    std::chrono::microseconds{0}, nullptr});
+	}
+
+	// Non-hardware handles share their backend (the ESS simulator rsp. the dump
+	// file), hence their reads are serialized, but still run on the workers.
+	std::mutex shared_backend;
+
+	auto const read_one = [&handles, &results, &shared_backend, runtime](size_t const index) {
+		TraceReadoutResult& result = results[index];
+		auto const start = std::chrono::steady_clock::now();
+		try {
+			if (!handles[index]) {
+				throw std::invalid_argument("read_trace_pulses: invalid FPGA handle");
+			}
+			if (boost::dynamic_pointer_cast<Handle::FPGAHw>(handles[index])) {
+				result.pulse_events = read_trace_pulses(*handles[index], runtime);
+			} else {
+				std::lock_guard<std::mutex> lock(shared_backend);
+				result.pulse_events = read_trace_pulses(*handles[index], runtime);
+			}
+		} catch (...) {
+			result.error = std::current_exception();
+		}
+		result.duration = std::chrono::duration_cast<std::chrono::microseconds>(
+		    std::chrono::steady_clock::now() - start);
+	};
+
+	size_t const num_workers = std::min(
+	    handles.size(), num_threads == 0 ? handles.size() : num_threads);
+
+	// Each worker picks the next pending FPGA until all have been read.
+	std::atomic<size_t> next{0};
+	auto const work = [&handles, &next, &read_one]() {
+		for (size_t ii = next++; ii < handles.size(); ii = next++) {
+			read_one(ii);
+		}
+	};
+
+	{
+		std::vector<std::thread> workers;
+		// Joins the started workers when leaving the scope, also if starting
+		// another one throws: destroying a joinable thread calls std::terminate.
+		struct JoinGuard
+		{
+			std::vector<std::thread>& threads;
+			~JoinGuard()
+			{
+				for (auto& thread : threads) {
+					thread.join();
+				}
+			}
+		} const join_guard{workers};
+
+		workers.reserve(num_workers);
+		for (size_t ii = 0; ii < num_workers; ++ii) {
+			workers.emplace_back(work);
+		}
+	}
+
+	for (auto const& result : results) {
+		if (result.success()) {
+			LOG4CXX_DEBUG(
+			    logger, halco::hicann::v2::short_format(result.fpga)
+			                << " read " << result.pulse_events.size() << " pulse events in "
+			                << result.duration.count() << " us");
+		} else {
+			LOG4CXX_ERROR(
+			    logger, halco::hicann::v2::short_format(result.fpga)
+			                << " trace readout failed after " << result.duration.count()
+			                << " us");
+		}
+	}
+
+	return results;
+}
+
 
 HALBE_SETTER(
 	set_spinnaker_receive_port,
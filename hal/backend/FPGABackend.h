@@ -1,8 +1,14 @@
 #pragma once
 
+#include <chrono>
+#include <exception>
+#include <functional>
 #include <vector>
 
+#include <boost/shared_ptr.hpp>
+
 #include "halco/hicann/v2/fwd.h"
+#include "halco/hicann/v2/external.h"
 #include "hal/FPGAContainer.h"
 //#include "hal/FPGA.h"
 
@@ -133,6 +139,55 @@ void write_playback_program(
     bool enable_trace_recording,
     bool drop_background_events);
 
+#ifndef PYPLUSPLUS
+/// Progress and throughput of a chunked playback upload, cf. write_playback_program_chunked.
+struct PlaybackUploadStatistics
+{
+	/// Number of pulses of the playback program
+	size_t pulses;
+	/// Number of pulses handed to the host application layer so far
+	size_t pulses_uploaded;
+	/// Wall-clock time since the start of the upload
+	std::chrono::microseconds duration;
+
+	/// Upload throughput in pulses per second.
+	double pulses_per_second() const;
+};
+
+/// Receives the progress of a chunked playback upload, cf. write_playback_program_chunked.
+typedef std::function<void(PlaybackUploadStatistics const&)> playback_progress_type;
+
+/**
+ * @brief Chunked upload of a playback program with progress reporting.
+ *
+ * The pulse list is converted and handed to the host application layer in
+ * slices of chunk_size pulses, progress is reported after each slice.  The
+ * slices are processed one after another, i.e. the upload is not faster than
+ * write_playback_program; it only allows monitoring long uploads.
+ * Arguments as for write_playback_program, the resulting playback program is
+ * identical.
+ *
+ * @param chunk_size Number of pulses per slice, must be non-zero
+ * @param progress Called after each uploaded slice (optional)
+ * @return Statistics of the completed upload
+ *
+ * @throws std::runtime_error if a pulse is too early for fpga_hicann_delay.
+ * As the pulse list is sorted, no pulse has been uploaded in this case.
+ * @note For non-hardware handles the whole list is written at once and
+ * progress is reported once.
+ * @notice Performance-optimized function has not been exposed to Python.
+ */
+PlaybackUploadStatistics write_playback_program_chunked(
+    Handle::FPGA& f,
+    PulseEventContainer const& st,
+    PulseEvent::spiketime_t runtime,
+    uint16_t fpga_hicann_delay,
+    bool enable_trace_recording,
+    bool drop_background_events,
+    size_t chunk_size,
+    playback_progress_type const& progress = playback_progress_type());
+#endif // !PYPLUSPLUS
+
 /**
  * Check if end-of-experiment FPGA config packet was acknowledged by FPGA
  * (which indicates that buffering has completed).
@@ -149,6 +204,80 @@ bool get_pbmem_buffering_completed(Handle::FPGA & f);
 PulseEventContainer::container_type read_trace_pulses(
     Handle::FPGA& f, PulseEvent::spiketime_t runtime);
 
+/**
+ * @brief Same as read_trace_pulses, intended for Python.
+ *
+ * In Python, the pulses are returned as structured NumPy array with the fields
+ * time and label, which views the received buffer without copying it, whereas
+ * read_trace_pulses returns a sequence of PulseEvent.
+ */
+PulseEventContainer::container_type read_trace_pulses_numpy(
+    Handle::FPGA& f, PulseEvent::spiketime_t runtime);
+
+#ifndef PYPLUSPLUS
+/// Receives batches of decoded pulse events, cf. streaming read_trace_pulses.
+typedef std::function<void(PulseEventContainer::container_type&&)> trace_pulse_sink_type;
+
+/**
+ * @brief Streaming variant of read_trace_pulses.
+ *
+ * Trace packets are decoded as they arrive and handed out to sink in batches
+ * of (about) batch_size pulse events while the experiment is still running.
+ * Pending pulse events are handed out early if no new data arrives.  Batches
+ * are handed out in order, overflow and late-pulse timestamp reconstruction
+ * is the same as for the non-streaming variant.
+ *
+ * @param runtime Experiment runtime in dnc cycles
+ * @param sink Called for each batch of pulse events, must not be empty
+ * @param batch_size Target number of pulse events per batch, must be non-zero
+ *
+ * @note For non-hardware handles the trace is read completely before it is
+ *       handed out in batches.
+ * @notice Performance-optimized function has not been exposed to Python.
+ */
+void read_trace_pulses(
+    Handle::FPGA& f,
+    PulseEvent::spiketime_t runtime,
+    trace_pulse_sink_type const& sink,
+    size_t batch_size = 4096);
+
+/// Result of the trace readout of a single FPGA, cf. FPGA-parallel read_trace_pulses.
+struct TraceReadoutResult
+{
+	halco::hicann::v2::FPGAGlobal fpga;
+	PulseEventContainer::container_type pulse_events;
+	/// Wall-clock time spent in the readout of this FPGA
+	std::chrono::microseconds duration;
+	/// Set if the readout failed, pulse_events are incomplete in that case
+	std::exception_ptr error;
+
+	bool success() const { return !error; }
+};
+
+/**
+ * @brief FPGA-parallel variant of read_trace_pulses.
+ *
+ * Drains and decodes the trace streams of all FPGAs concurrently, hence the
+ * total readout time is governed by the slowest FPGA rather than by the sum of
+ * all FPGAs.  Failures do not abort the readout of the other FPGAs, they are
+ * reported per FPGA, as are invalid (null) handles.
+ *
+ * All handles are read by the workers.  Reads of non-hardware handles are
+ * serialized among each other, as they share their backend (simulator or
+ * dump file).
+ *
+ * @param runtime Experiment runtime in dnc cycles
+ * @param num_threads Maximum number of concurrent readouts, 0 means one per FPGA
+ * @return One result per handle, in the order of the handles
+ *
+ * @notice Performance-optimized function has not been exposed to Python.
+ */
+std::vector<TraceReadoutResult> read_trace_pulses(
+    std::vector<boost::shared_ptr<Handle::FPGA> > const& handles,
+    PulseEvent::spiketime_t runtime,
+    size_t num_threads = 0);
+#endif // !PYPLUSPLUS
+
 /**
 *  Set port that the SpiNNaker pulse interface reacts on.
 */
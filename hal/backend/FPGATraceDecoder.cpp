@@ -0,0 +1,307 @@
+#include "hal/backend/FPGATraceDecoder.h"
+
+#include <sstream>
+
+#include <boost/config.hpp>
+#include <log4cxx/logger.h>
+
+#include "halco/hicann/v2/format_helper.h"
+
+static log4cxx::LoggerPtr logger = log4cxx::Logger::getLogger("halbe.backend.fpga");
+
+namespace HMF {
+namespace FPGA {
+
+namespace {
+
+union entry_type
+{
+	std::uint32_t raw;
+	// A pulse event is indicated by two '0' high-order bits.  The sequence '01'
+	// is used to mark the absence of a pulse event in a packet that contains an
+	// overflow indicator.
+	struct
+	{
+		// LSBs of pulse event timestamp, MSBs are transmitted via overflow indicators.
+		unsigned int timestamp : TraceDecoder::event_timestamp_bits;
+		// Label of pulse event, as described below.
+		unsigned int label : 12;
+		unsigned int : 2; // padding
+		// MSB of the FPGA systime counter.
+		unsigned int fpga_msb : 1;
+		// Two zero-bits, to encode entry type.
+		unsigned int zero_bits : 2;
+	} event;
+	// An overflow indicator is indicated by a '1' high-order bit.
+	struct
+	{
+		unsigned int count : 31;
+		unsigned int is_overflow : 1;
+	} overflow;
+};
+
+static_assert(sizeof(entry_type) == sizeof(std::uint32_t), "unexpected trace entry size");
+
+} // namespace
+
+constexpr std::uint64_t TraceDecoder::end_of_trace_marker;
+constexpr size_t TraceDecoder::event_timestamp_bits;
+constexpr std::uint64_t TraceDecoder::max_timestamp_cnt;
+
+TraceDecoder::TraceDecoder(halco::hicann::v2::FPGAGlobal const& coordinate) :
+	m_coordinate(coordinate),
+	m_overflow_count(0),
+	m_pulse_event_count(0),
+	m_received_eot(false),
+	m_has_last_event(false),
+	m_last_event()
+{}
+
+void TraceDecoder::reset()
+{
+	m_overflow_count = 0;
+	m_pulse_event_count = 0;
+	m_received_eot = false;
+	m_has_last_event = false;
+}
+
+bool TraceDecoder::received_end_of_trace() const
+{
+	return m_received_eot;
+}
+
+std::uint64_t TraceDecoder::overflow_count() const
+{
+	return m_overflow_count;
+}
+
+std::uint64_t TraceDecoder::pulse_event_count() const
+{
+	return m_pulse_event_count;
+}
+
+size_t TraceDecoder::decode(std::uint64_t const* const pdu, size_t const len, container_type& pulse_events)
+{
+#ifdef NDEBUG
+	return decode_batch(pdu, len, pulse_events);
+#else
+	return decode_entries(pdu, len, pulse_events);
+#endif // NDEBUG
+}
+
+size_t TraceDecoder::decode_batch(
+    std::uint64_t const* const pdu, size_t const len, container_type& pulse_events)
+{
+	if (m_received_eot) {
+		return 0;
+	}
+
+	size_t num_words = len;
+	for (size_t ii = 0; ii < len; ++ii) {
+		if (pdu[ii] == end_of_trace_marker) {
+			num_words = ii;
+			m_received_eot = true;
+			break;
+		}
+	}
+	if (BOOST_UNLIKELY(m_received_eot && (num_words + 1) < len)) {
+		std::stringstream debug_msg;
+		debug_msg << halco::hicann::v2::short_format(m_coordinate)
+		          << " unexpected end-of-trace marker"
+		             " within other data: " << num_words << " out of "
+		          << (len - 1) << ".\n"
+		          << " Next entry looks like: " << std::hex
+		          << pdu[num_words + 1] << std::dec
+		          << "\n";
+		LOG4CXX_ERROR(logger, debug_msg.str());
+	}
+
+	// Every entry is written, but only pulse events advance the output position.
+	size_t const offset = pulse_events.size();
+	pulse_events.resize(offset + 2 * num_words);
+	PulseEvent* const out = pulse_events.data() + offset;
+
+	std::uint64_t overflow_count = m_overflow_count;
+	size_t count = 0;
+	for (size_t ii = 0; ii < num_words; ++ii) {
+		std::uint32_t const entries[2] = {static_cast<std::uint32_t>(pdu[ii]),
+		                                  static_cast<std::uint32_t>(pdu[ii] >> 32)};
+		for (std::uint32_t const raw : entries) {
+			std::uint32_t const timestamp = raw & (max_timestamp_cnt - 1);
+			std::uint32_t const label = (raw >> event_timestamp_bits) & 0xfff;
+			// two '0' high-order bits mark a pulse event
+			std::uint32_t const is_pulse = (raw >> 30) == 0;
+			// timestamp MSB set, FPGA systime MSB not set: pulse registered before overflow
+			std::uint32_t const is_late = (raw >> (event_timestamp_bits - 1)) & ~(raw >> 29) & 1;
+			// late pulses without preceding overflow are early pulses and get ignored
+			std::uint32_t const is_valid = is_pulse & ~(is_late & (overflow_count == 0));
+
+			out[count] = PulseEvent(
+			    PulseAddress(label), timestamp + (overflow_count - is_late) * max_timestamp_cnt);
+			count += is_valid;
+		}
+		// overflow indicators are only valid at odd indices, i.e. the upper half
+		overflow_count += entries[1] >> 31;
+	}
+	pulse_events.resize(offset + count);
+
+	m_overflow_count = overflow_count;
+	m_pulse_event_count += count;
+	if (count > 0) {
+		m_last_event = pulse_events.back();
+		m_has_last_event = true;
+	}
+	return count;
+}
+
+size_t TraceDecoder::decode_entries(
+    std::uint64_t const* const pdu, size_t const len, container_type& pulse_events)
+{
+	// A pulse event label consists of 12 bit used as follows:
+	// |     3bit    |   3bit   |    6bit   |
+	// | HICANNOnDNC | GbitLink | L1Address |
+	// Each pulse label will be converted to a 16 bit PulseAddress,
+	// where the additional 4 bit remain unused.
+
+	bool const trace_enabled = logger->isTraceEnabled();
+#define HALBE_RTP_TRACE(message) \
+	{ \
+		if (LOG4CXX_UNLIKELY(trace_enabled)) { \
+			::log4cxx::helpers::MessageBuffer oss_; \
+			logger->forcedLog( \
+			    ::log4cxx::Level::getTrace(), oss_.str(oss_ << message), LOG4CXX_LOCATION); \
+		} \
+	}
+
+	entry_type const* const entries = reinterpret_cast<entry_type const*>(pdu);
+
+	size_t received_pulse_events_count = 0;
+	for (size_t ii = 0; (!m_received_eot) && (ii < 2 * len); ++ii) {
+
+		// check for end-of-trace marker every 64-bit word
+		if ((ii % 2) == 0) {
+			if (pdu[ii / 2] == end_of_trace_marker) {
+				if (((ii / 2) + 1) < len) {
+					std::stringstream debug_msg;
+					debug_msg << halco::hicann::v2::short_format(m_coordinate)
+					          << " unexpected end-of-trace marker"
+					             " within other data: " << ii / 2 << " out of "
+					          << (len - 1) << ".\n"
+					          << " Next entry looks like: " << std::hex
+					          << pdu[(ii / 2) + 1] << std::dec
+					          << "\n";
+					LOG4CXX_ERROR(logger, debug_msg.str());
+				}
+				// packet handling done, bail out
+				m_received_eot = true;
+				break;
+			}
+		}
+
+		// non-eot data handling below
+		auto const& entry = entries[ii];
+
+		if (entry.overflow.is_overflow) {
+			if (BOOST_UNLIKELY(ii % 2 != 1)) {
+#ifndef NDEBUG
+				// Overflow entries should only occur at odd indices.
+				LOG4CXX_WARN(logger,
+				             halco::hicann::v2::short_format(m_coordinate)
+				                 << " garbage overflow entry at even index " << ii
+				                 << ": " << std::showbase << std::hex << entry.raw
+				                 << " (issue 2355)");
+#endif // !NDEBUG
+				continue;
+			}
+			m_overflow_count += 1;
+
+#ifndef NDEBUG
+			HALBE_RTP_TRACE(
+				"overflow packet " << m_overflow_count
+				<< std::showbase
+				<< " with value " << std::hex << entry.overflow.count
+				<< " (" << std::dec << entry.overflow.count << ")" << " received.\n"
+				<< " current offset is " << std::hex << m_overflow_count * max_timestamp_cnt
+				<< " (" << std::dec << m_overflow_count * max_timestamp_cnt << ")");
+
+			if (m_overflow_count != entry.overflow.count) {
+				LOG4CXX_WARN(
+				    logger,
+				    halco::hicann::v2::short_format(m_coordinate)
+				        << " Local overflow count " << m_overflow_count
+				        << " does not match contents of overflow indicator "
+				        << entry.overflow.count);
+			}
+#endif // !NDEBUG
+
+			continue;
+		} else if (entry.event.zero_bits != 0) {
+			// no overflow, no spike => garbage
+			continue;
+		}
+
+		std::uint64_t full_timestamp =
+			static_cast<std::uint64_t>(entry.event.timestamp) +
+			m_overflow_count * max_timestamp_cnt;
+		bool timestamp_msb = entry.event.timestamp >> (event_timestamp_bits - 1);
+
+		// Detect special case that HICANN timestamp was registered before
+		// overflow, but pulse arrives in FPGA after overflow and an overflow
+		// packet was generated.
+		if (timestamp_msb && !entry.event.fpga_msb) {
+			if (full_timestamp < max_timestamp_cnt) {
+				// Ignore early pulses.
+				continue;
+			}
+			// Undo last overflow for that pulse.
+			full_timestamp -= max_timestamp_cnt;
+		}
+
+		PulseEvent const pulse_event(PulseAddress(entry.event.label), full_timestamp);
+
+#ifndef NDEBUG
+		HALBE_RTP_TRACE(
+			"received pulse event " << m_pulse_event_count << " (entry " << ii << "):\n"
+			<< std::showbase
+			<< "id: " << std::hex << entry.event.label << ", "
+			<< "timestamp: " << std::hex << entry.event.timestamp
+			<< " (" << std::dec << entry.event.timestamp << ")" << ", "
+			<< "msb timestamp/fpga: " << timestamp_msb << "/" << entry.event.fpga_msb << ",\n"
+			<< "full timestamp: " << std::hex << full_timestamp
+			<< " (" << std::dec << full_timestamp << ")");
+
+		if (m_has_last_event) {
+			// Old bug where trace memory potentially stored pulse twice while
+			// sending overflow packet, should not occur anymore.
+			// TODO 2016-04-27: Remove check when it's absolutely sure that the bug is
+			// fixed.
+			if (m_last_event.getLabel() == entry.event.label &&
+			    (m_last_event.getTime() == full_timestamp ||
+			     (m_last_event.getTime() + max_timestamp_cnt) == full_timestamp)) {
+				LOG4CXX_WARN(logger,
+				             halco::hicann::v2::short_format(m_coordinate)
+				                 << " received pulse twice (issue 2022): "
+				                 << m_last_event.getTime()
+				                 << " == " << full_timestamp << "\n(32 bit entry "
+				                 << ii << "/" << (2 * len)
+				                 << " of ARQ frame, spike " << m_pulse_event_count
+				                 << ") with label " << entry.event.label);
+			}
+		}
+		m_last_event = pulse_event;
+		m_has_last_event = true;
+#endif // !NDEBUG
+
+		++received_pulse_events_count;
+		++m_pulse_event_count;
+
+		pulse_events.push_back(pulse_event);
+	}
+
+#undef HALBE_RTP_TRACE
+
+	return received_pulse_events_count;
+}
+
+} // namespace FPGA
+} // namespace HMF
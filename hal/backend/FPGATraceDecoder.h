@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "halco/hicann/v2/external.h"
+#include "hal/FPGAContainer.h"
+
+namespace HMF {
+namespace FPGA {
+
+/**
+ * Stateful decoder for the payload of FPGA trace memory (FPGATRACE) packets.
+ *
+ * We have to handle all possible types of packets described in section
+ * "I-10.2.1. FPGA Trace / Pulse Data" of the specification, i.e. pulse
+ * entries and overflow indicators.  Each 64 bit word of a packet consists of
+ * two entries aligned to 32 bit.
+ *
+ * The decoder keeps the overflow count (i.e. the MSBs of the reconstructed
+ * timestamps) across packets, hence packets of one trace have to be fed in
+ * order into the same decoder instance.  It does not own the decoded pulse
+ * events, these are appended to a caller-provided container.  This allows
+ * to hand out decoded events in batches while the trace is still being read.
+ */
+class TraceDecoder
+{
+public:
+	typedef PulseEventContainer::container_type container_type;
+
+	/// Payload word marking the end of the trace.
+	static constexpr std::uint64_t end_of_trace_marker = 0x4000E11D40000000ull;
+
+	static constexpr size_t event_timestamp_bits = 15;
+	static constexpr std::uint64_t max_timestamp_cnt = 1 << event_timestamp_bits;
+
+	/// @param coordinate FPGA the trace originates from (used for log messages only)
+	explicit TraceDecoder(halco::hicann::v2::FPGAGlobal const& coordinate);
+
+	/**
+	 * Decodes the payload of a single trace packet.
+	 *
+	 * @param pdu Payload of the packet (64 bit words)
+	 * @param len Number of 64 bit words in the payload
+	 * @param pulse_events Decoded pulse events get appended to this container
+	 *
+	 * @return Number of pulse events appended to pulse_events
+	 * @note Decoding stops at the end-of-trace marker, cf. received_end_of_trace().
+	 * @note Uses decode_batch() in release builds and decode_entries() otherwise.
+	 */
+	size_t decode(std::uint64_t const* pdu, size_t len, container_type& pulse_events);
+
+	/**
+	 * Decodes the payload entry by entry, including all consistency checks and
+	 * trace logging of debug builds.
+	 *
+	 * Arguments and return value as for decode().
+	 */
+	size_t decode_entries(std::uint64_t const* pdu, size_t len, container_type& pulse_events);
+
+	/**
+	 * Branch-light decoder for a whole packet payload.
+	 *
+	 * Each entry is classified by masks (pulse, overflow, garbage) and written
+	 * unconditionally to storage reserved for the whole payload, only valid pulse
+	 * events advance the output position.  The decoded pulse events are identical
+	 * to the ones of decode_entries(), but no consistency checks are performed.
+	 *
+	 * Arguments and return value as for decode().
+	 */
+	size_t decode_batch(std::uint64_t const* pdu, size_t len, container_type& pulse_events);
+
+	/// Returns true after the end-of-trace marker has been decoded.
+	bool received_end_of_trace() const;
+
+	/// Number of overflow indicators decoded so far.
+	std::uint64_t overflow_count() const;
+
+	/// Number of pulse events decoded so far.
+	std::uint64_t pulse_event_count() const;
+
+	/// Resets the decoder to the state at the begin of a trace.
+	void reset();
+
+private:
+	halco::hicann::v2::FPGAGlobal m_coordinate;
+	std::uint64_t m_overflow_count;
+	std::uint64_t m_pulse_event_count;
+	bool m_received_eot;
+
+	// last decoded pulse event, used for the detection of duplicated pulses
+	// across packet (and batch) boundaries in debug builds
+	bool m_has_last_event;
+	PulseEvent m_last_event;
+};
+
+} // namespace FPGA
+} // namespace HMF
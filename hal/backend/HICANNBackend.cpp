@@ -1,8 +1,16 @@
 #include "hal/backend/HICANNBackend.h"
 #include "hal/backend/HICANNBackendHelper.h"
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <map>
+#include <numeric>
+#include <sstream>
+#include <thread>
+#include <utility>
 #include <bitter/bitter.h>
-#include "pythonic/zip.h"
 
 #include "hal/backend/FPGABackend.h"
 #include "hal/HICANN/FGInstruction.h"
@@ -68,6 +76,9 @@ HALBE_SETTER(
 	}
 
 	reticle.hicann[h.jtag_addr()]->getLC(index).write_cfg(addr, cfg);
+
+	if (auto* const shadow = enabled_shadow_state(h))
+		shadow->crossbar[std::make_pair(y, s)] = switches;
 }
 
 
@@ -76,6 +87,10 @@ HALBE_GETTER(HICANN::CrossbarRow, get_crossbar_switch_row,
 	HLineOnHICANN const&, y,
 	Side const&, s)
 {
+	if (auto const* cached =
+	        shadow_lookup(h, &Handle::HICANNHw::ShadowState::crossbar, std::make_pair(y, s)))
+		return *cached;
+
 	ReticleControl& reticle = *h.get_reticle();
 
 	ci_data_t cfg  = 0;    //hardware-friendly data format
@@ -93,6 +108,9 @@ HALBE_GETTER(HICANN::CrossbarRow, get_crossbar_switch_row,
 		size_t ii = (s == right) ? 3-i : i;
 		returnvalue[i] = bit::test(cfg, ii);
 	}
+
+	if (auto* const shadow = enabled_shadow_state(h))
+		shadow->crossbar[std::make_pair(y, s)] = returnvalue;
 	return returnvalue;
 }
 
@@ -171,6 +189,11 @@ HALBE_SETTER(
 	WeightRow const&, weights)
 {
 	set_weights_row_impl(h, synapse_controller, s, weights);
+
+	if (auto* const shadow = enabled_shadow_state(h)) {
+		shadow->weights[s] = weights;
+		shadow->synapse_controllers[s.toSynapseArrayOnHICANN()] = synapse_controller;
+	}
 }
 
 HALBE_SETTER(
@@ -185,8 +208,15 @@ HALBE_SETTER(
 		throw std::invalid_argument("set_weights_row: number of handles, "
 		                            "synapse controllers and data does not match");
 
-	for (auto [h, sc, d] : pythonic::zip(handles, synapse_controllers, data)) {
-		set_weights_row(*h, sc, s, d);
+	for_each_reticle(handles, [&](std::vector<size_t> const& indices) {
+		set_weights_row_impl(handles, indices, synapse_controllers, s, data);
+	});
+
+	for (size_t ii = 0; ii < n_hicanns; ++ii) {
+		if (auto* const shadow = enabled_shadow_state(*handles[ii])) {
+			shadow->weights[s] = data[ii];
+			shadow->synapse_controllers[s.toSynapseArrayOnHICANN()] = synapse_controllers[ii];
+		}
 	}
 }
 
@@ -195,6 +225,9 @@ HALBE_GETTER(WeightRow, get_weights_row,
 	SynapseController const&, synapse_controller,
 	SynapseRowOnHICANN const&, s)
 {
+	if (auto const* cached = shadow_lookup(h, &Handle::HICANNHw::ShadowState::weights, s))
+		return *cached;
+
 	ReticleControl& reticle = *h.get_reticle();
 
 	HicannCtrl::Synapse const index =
@@ -240,6 +273,10 @@ HALBE_GETTER(WeightRow, get_weights_row,
 	ctrl_reg.cmd = SynapseControllerCmd::CLOSE_ROW;
 	set_syn_ctrl_and_guard(h, s.toSynapseArrayOnHICANN(), synapse_controller_copy);
 
+	if (auto* const shadow = enabled_shadow_state(h)) {
+		shadow->weights[s] = returnvalue;
+		shadow->synapse_controllers[s.toSynapseArrayOnHICANN()] = synapse_controller;
+	}
 	return returnvalue;
 }
 
@@ -252,6 +289,11 @@ HALBE_SETTER(
 	DecoderDoubleRow const&, data)
 {
 	set_decoder_double_row_impl(h, synapse_controller, s, data);
+
+	if (auto* const shadow = enabled_shadow_state(h)) {
+		shadow->decoders[s] = data;
+		shadow->synapse_controllers[s.toSynapseArrayOnHICANN()] = synapse_controller;
+	}
 }
 
 HALBE_SETTER(
@@ -266,10 +308,16 @@ HALBE_SETTER(
 		throw std::invalid_argument("set_decoder_double_row: number of handles, "
 		                            "synapse controllers and data does not match");
 
-	for (auto [h, sc, d] : pythonic::zip(handles, synapse_controllers, data)) {
-		set_decoder_double_row(*h, sc, syndrv, d);
-	}
+	for_each_reticle(handles, [&](std::vector<size_t> const& indices) {
+		set_decoder_double_row_impl(handles, indices, synapse_controllers, syndrv, data);
+	});
 
+	for (size_t ii = 0; ii < n_hicanns; ++ii) {
+		if (auto* const shadow = enabled_shadow_state(*handles[ii])) {
+			shadow->decoders[syndrv] = data[ii];
+			shadow->synapse_controllers[syndrv.toSynapseArrayOnHICANN()] = synapse_controllers[ii];
+		}
+	}
 }
 
 HALBE_GETTER(DecoderDoubleRow, get_decoder_double_row,
@@ -277,6 +325,9 @@ HALBE_GETTER(DecoderDoubleRow, get_decoder_double_row,
 	SynapseController const&, synapse_controller,
 	SynapseDriverOnHICANN const&, s)
 {
+	if (auto const* cached = shadow_lookup(h, &Handle::HICANNHw::ShadowState::decoders, s))
+		return *cached;
+
 	ReticleControl& reticle = *h.get_reticle();
 	SynapseControl& sc = reticle.hicann[h.jtag_addr()]->getSC(
 	    s.toSynapseArrayOnHICANN().isTop() ? HicannCtrl::SYNAPSE_TOP : HicannCtrl::SYNAPSE_BOTTOM);
@@ -327,6 +378,10 @@ HALBE_GETTER(DecoderDoubleRow, get_decoder_double_row,
 	returnvalue[swtop]    = top_from_decoder(hwdata[top], hwdata[bottom]);
 	returnvalue[swbottom] = bot_from_decoder(hwdata[top], hwdata[bottom]);
 
+	if (auto* const shadow = enabled_shadow_state(h)) {
+		shadow->decoders[s] = returnvalue;
+		shadow->synapse_controllers[s.toSynapseArrayOnHICANN()] = synapse_controller;
+	}
 	return returnvalue;
 }
 
@@ -339,96 +394,50 @@ HALBE_SETTER(
 	SynapseDriver const&, driver)
 {
 	ReticleControl& reticle = *h.get_reticle();
+	SynapseControl& sc = reticle.hicann[h.jtag_addr()]->getSC(to_synapse_controller(s));
 
-	//TOP/BOT here refers to hardware coordinates
-	bool TOP = top, BOT = bottom; //init with values where SW coords = HW coords (top half)
-
-	//calculate the correct hardware address of the line and choose the synapse block instance
-	uint32_t addr[2];
-	HicannCtrl::Synapse index;
-
-	if (s.line() < 112){ //upper half of ANNCORE
-		addr[BOT] = 222 - (s.line()*2);
-		addr[TOP] = 222 - (s.line()*2) + 1;
-		index = HicannCtrl::SYNAPSE_TOP;
-	}
-	else{ //lower half of ANNCORE, SW coords != HW coords
-		BOT = top;
-		TOP = bottom;
-		addr[BOT] = (s.line() - 112)*2;
-		addr[TOP] = (s.line() - 112)*2 + 1;
-		index = HicannCtrl::SYNAPSE_BOTTOM;
-	}
-	SynapseControl& sc = reticle.hicann[h.jtag_addr()]->getSC(index);
-
-	//convert data to hardware format
-	const std::bitset<8> zeropad = 0;
-	std::array<std::bitset<16>, 2> gmaxfrac;
-	std::array<std::bitset<16>, 2> preouts;
-	std::array<std::bitset<16>, 2> hwconfig;
-
-	typedef bitset<4> t4;
-	for (auto const& tt : { top, bottom }) {
-		gmaxfrac[tt] = bit::concat(t4(driver[tt].get_gmax_div(right)),
-								   t4(driver[tt].get_gmax_div(left))).to_ulong();
+	for (auto const& write : synapse_driver_writes(s, driver)) {
+		sc.write_data(write.first, write.second);
+		wait_by_dummy(
+		    h, s.toSynapseArrayOnHICANN(), synapse_controller.cnfg_reg,
+		    synapse_controller.syndrv_timings.cycles_write());
 	}
+}
 
-	//hardware coords here as the preout values depend on each other and their hardware number
-	typedef bitset<2> t2;
-
-	t2 const p0(driver[RowOnSynapseDriver(BOT)].get_decoder(top));
-	t2 const p1(driver[RowOnSynapseDriver(TOP)].get_decoder(top));
-	t2 const p2(driver[RowOnSynapseDriver(BOT)].get_decoder(bottom));
-	t2 const p3(driver[RowOnSynapseDriver(TOP)].get_decoder(bottom));
-
-	preouts = encode_preouts(p0, p1, p2, p3);
-
-	hwconfig[BOT] = bit::concat(zeropad,
-				bit::convert<bool, 1>(driver.stp_enable),
-				bit::convert<bool, 1>(driver.enable),
-				bit::convert<bool, 1>(driver.locin),
-				bit::convert<bool, 1>(driver.connect_neighbor),
-				t2(driver[RowOnSynapseDriver(BOT)].get_gmax()),
-				bit::convert<bool, 1>(driver[RowOnSynapseDriver(BOT)].get_syn_in(right)),
-				bit::convert<bool, 1>(driver[RowOnSynapseDriver(BOT)].get_syn_in(left)));
-
-	hwconfig[TOP] = bit::concat(zeropad,
-				bit::convert<bool, 1>(driver.stp_mode),
-				driver.stp_cap,
-				t2(driver[RowOnSynapseDriver(TOP)].get_gmax()),
-				bit::convert<bool, 1>(driver[RowOnSynapseDriver(TOP)].get_syn_in(right)),
-				bit::convert<bool, 1>(driver[RowOnSynapseDriver(TOP)].get_syn_in(left)));
+HALBE_SETTER(
+	set_synapse_driver,
+	std::vector<boost::shared_ptr<Handle::HICANN> >, handles,
+	std::vector<SynapseController> const&, synapse_controllers,
+	halco::hicann::v2::SynapseDriverOnHICANN const&, s,
+	std::vector<SynapseDriver> const&, data)
+{
+	const size_t n_hicanns = handles.size();
+	if (data.size() != n_hicanns || synapse_controllers.size() != n_hicanns)
+		throw std::invalid_argument("set_synapse_driver: number of handles, "
+		                            "synapse controllers and data does not match");
 
-	//right drivers have registers shifted by 8 bits
-	if (s.toSideHorizontal()==right) {
-		for (size_t i = std::min(TOP, BOT); i <= std::max(TOP, BOT); i++) {
-			gmaxfrac[i] = gmaxfrac[i] << 8;
-			preouts[i] = preouts[i] << 8;
-			hwconfig[i] = hwconfig[i] << 8;
+	for_each_reticle(handles, [&](std::vector<size_t> const& indices) {
+		std::vector<SynapseControl*> scs;
+		std::vector<std::array<std::pair<uint32_t, uint32_t>, 6> > writes;
+		for (size_t const index : indices) {
+			Handle::HICANNHw& h = *handles[index];
+			scs.push_back(&h.get_reticle()->hicann[h.jtag_addr()]->getSC(to_synapse_controller(s)));
+			writes.push_back(synapse_driver_writes(s, data[index]));
 		}
-	}
-
-	auto wait_dummy_write = [&h, &s, &synapse_controller]() {
-		wait_by_dummy(
-		    h, s.toSynapseArrayOnHICANN(), synapse_controller.cnfg_reg,
-		    synapse_controller.syndrv_timings.cycles_write());
-	};
 
-	//write gmax divisors
-	sc.write_data(facets::SynapseControl::sc_engmax+addr[BOT], gmaxfrac[BOT].to_ulong());
-	wait_dummy_write();
-	sc.write_data(facets::SynapseControl::sc_engmax+addr[TOP], gmaxfrac[TOP].to_ulong());
-	wait_dummy_write();
-	//write preouts
-	sc.write_data(facets::SynapseControl::sc_endrv+addr[BOT], preouts[bottom].to_ulong());
-	wait_dummy_write();
-	sc.write_data(facets::SynapseControl::sc_endrv+addr[TOP], preouts[top].to_ulong());
-	wait_dummy_write();
-	//write driver configuration registers
-	sc.write_data(facets::SynapseControl::sc_encfg+addr[BOT], hwconfig[BOT].to_ulong());
-	wait_dummy_write();
-	sc.write_data(facets::SynapseControl::sc_encfg+addr[TOP], hwconfig[TOP].to_ulong());
-	wait_dummy_write();
+		// interleave HICANNs: write the same register on all, then guard all
+		for (size_t step = 0; step < std::tuple_size<decltype(writes)::value_type>::value; ++step) {
+			for (size_t ii = 0; ii < indices.size(); ++ii) {
+				scs[ii]->write_data(writes[ii][step].first, writes[ii][step].second);
+			}
+			for (size_t ii = 0; ii < indices.size(); ++ii) {
+				SynapseController const& synapse_controller = synapse_controllers[indices[ii]];
+				wait_by_dummy(
+				    *handles[indices[ii]], s.toSynapseArrayOnHICANN(), synapse_controller.cnfg_reg,
+				    synapse_controller.syndrv_timings.cycles_write());
+			}
+		}
+	});
 }
 
 
@@ -668,32 +677,69 @@ HALBE_GETTER(HICANN::FGErrorResultQuadRow,
 }
 
 
+double FGWaitStatistics::polls_per_write_cycle() const
+{
+	return write_cycles ? static_cast<double>(polls) / write_cycles : 0.;
+}
+
+FGWaitStatistics get_fg_wait_statistics(Handle::HICANN & h)
+{
+	FGWaitStatistics statistics{0, 0, std::chrono::nanoseconds(0), std::chrono::nanoseconds(0)};
+	if (auto* const hw = dynamic_cast<Handle::HICANNHw*>(&h)) {
+		auto const& state = hw->fg_controller_state();
+		statistics.write_cycles = state.write_cycles;
+		statistics.polls = state.polls;
+		statistics.poll_time = state.poll_time;
+		statistics.wait_time = state.wait_time;
+	}
+	return statistics;
+}
+
+void reset_fg_wait_statistics(Handle::HICANN & h)
+{
+	if (auto* const hw = dynamic_cast<Handle::HICANNHw*>(&h)) {
+		auto& state = hw->fg_controller_state();
+		state.write_cycles = 0;
+		state.polls = 0;
+		state.poll_time = std::chrono::nanoseconds(0);
+		state.wait_time = std::chrono::nanoseconds(0);
+	}
+}
+
+
 HALBE_SETTER(
 	set_fg_values,
 	Handle::HICANN &, h,
 	FGBlockOnHICANN const&, b,
-	FGBlock const&, fgb)
+	FGBlock const&, fgb,
+	bool const, double_buffered)
 {
-	ReticleControl& reticle = *h.get_reticle();
-	auto& fc = reticle.hicann[h.jtag_addr()]->getFC(b.toEnum());
+	auto const upload = [&h, &b, &fgb, double_buffered](size_t const row) {
+		return fg_upload_row(h, b, row, fgb.getFormattedRow(row), true, double_buffered);
+	};
 
 	// and finally analog FG values
+	bool bank = upload(0);
 	for (size_t row = 0; row < FGBlock::fg_lines; row++)
 	{
-		auto data = fgb.set_formatter(b, row);
-
-		size_t cnt = 0;
-		for (auto const& val : data)
-			fc.write_data(cnt++, val.to_ulong());
+		bool const last = (row + 1) == FGBlock::fg_lines;
 
 		//execute write cycle: first write down, then write up
-		fc.write_data(facets::FGControl::REG_ADDRINS,
-			FGInstruction::writeDown(row));
+		fg_write_instruction(h, b, FGInstruction::writeDown(row, bank));
+
+		// upload next row to the other bank while the controller is busy
+		bool next_bank = bank;
+		if (double_buffered && !last)
+			next_bank = upload(row + 1);
+
 		fg_busy_wait(h, b, row);
 
-		fc.write_data(facets::FGControl::REG_ADDRINS,
-			FGInstruction::writeUp(row));
+		fg_write_instruction(h, b, FGInstruction::writeUp(row, bank));
 		fg_busy_wait(h, b, row);
+
+		if (!double_buffered && !last)
+			next_bank = upload(row + 1);
+		bank = next_bank;
 	}
 }
 
@@ -706,53 +752,280 @@ HALBE_SETTER(
 	ReticleControl& reticle = *h.get_reticle();
 	auto& fc = reticle.hicann[h.jtag_addr()]->getFC(b.toEnum());
 
-	auto const data = fgr.set_formatter();
+	fg_write_ram(fc, fgr.getFormatted());
 
-	for (size_t cnt = 0; auto const& val : data) {
-		fc.write_data(cnt++, val.to_ulong());
-	}
+	auto& state = h.fg_controller_state();
+	state.ram_bank[b.toEnum()] = false;
+	state.ram_row[b.toEnum()] = boost::none;
 }
 
 
 HALBE_SETTER(
 	set_fg_values,
 	Handle::HICANN &, h,
-	FGControl const&, fg)
+	FGControl const&, fg,
+	bool const, double_buffered)
 {
-	ReticleControl& reticle = *h.get_reticle();
-	auto const getFC = [&h,&reticle](size_t ii) {
-		return reticle.hicann[h.jtag_addr()]->getFC(ii);
+	auto const write_instruction = [&h](
+		std::array<bool, 4> const& banks, FGInstruction (*instruction)(uint8_t, bool),
+		size_t const row) {
+		for (auto const& fgb : iter_all<FGBlockOnHICANN>())
+			fg_write_instruction(h, fgb, instruction(row, banks[fgb.toEnum()]));
 	};
 
 	////setting analog parameters
-	std::bitset<20> data;
+	std::array<bool, 4> banks = fg_upload_row(h, fg, 0, true, double_buffered);
 	for (size_t i = 0; i < FGBlock::fg_lines; i++) {
-		for (size_t blk = 0; blk < fg.size(); blk++) {
-			FGBlockOnHICANN b {Enum{blk}};
-			auto data = fg.getBlock(b).set_formatter(b, i);
-
-			size_t cnt = 0;
-			for (auto const& val : data)
-				getFC(blk).write_data(cnt++, val.to_ulong());
-		}
+		bool const last = (i + 1) == FGBlock::fg_lines;
 
 		//execute write cycle: first write down, then write up
-		for (size_t blk = 0; blk < 4; blk++)
-			getFC(blk).write_data(facets::FGControl::REG_ADDRINS,
-				FGInstruction::writeDown(i));
+		write_instruction(banks, &FGInstruction::writeDown, i);
+
+		// upload next row to the other bank while the controllers are busy
+		std::array<bool, 4> next_banks = banks;
+		if (double_buffered && !last)
+			next_banks = fg_upload_row(h, fg, i + 1, true, double_buffered);
 
 		// wait for all controllers to finish
 		fg_busy_wait(h);
 
-		for (size_t blk = 0; blk < fg.size(); blk++)
-			getFC(blk).write_data(facets::FGControl::REG_ADDRINS,
-				FGInstruction::writeUp(i));
+		write_instruction(banks, &FGInstruction::writeUp, i);
 
 		// wait for all controllers to finish
 		fg_busy_wait(h);
+
+		if (!double_buffered && !last)
+			next_banks = fg_upload_row(h, fg, i + 1, true, double_buffered);
+		banks = next_banks;
 	}
 }
 
+namespace {
+
+bool has_error(FGErrorResultRow const& row)
+{
+	for (size_t col = 0; col < FGBlock::fg_columns - 1; col++)
+		if (row[X(col)].get_error_flag())
+			return true;
+	return false;
+}
+
+/**
+ * Programs all rows of the HICANNs at indices (all on the same reticle).
+ *
+ * Instead of waiting for each HICANN in turn, the controllers of all HICANNs
+ * are polled and each one that has gone idle is handed its next write cycle
+ * right away.  Each HICANN is polled according to its own schedule (cf.
+ * fg_busy_wait), in between the calling thread sleeps until the earliest
+ * status read due.  Per FG block, the result of the first erroneous write
+ * cycle is kept, otherwise the one of the last write cycle.
+ */
+void schedule_fg_values(
+	std::vector<boost::shared_ptr<Handle::HICANNHw> > const& handles,
+	std::vector<size_t> const& indices,
+	std::vector<FGControl> const& fgs,
+	std::vector<FGErrorResultQuadRow>& results)
+{
+	using namespace std::chrono;
+	// Worst timing for a single row should be about 1.37s, cf. fg_busy_wait
+	auto const timeout = seconds(10);
+
+	struct State {
+		size_t row;
+		bool writeDown;
+		FGPollSchedule schedule;
+		steady_clock::time_point end_time;
+	};
+
+	auto const issued = [&timeout](Handle::HICANNHw& h, State& state) {
+		state.schedule = fg_poll_schedule(h);
+		state.end_time =
+		    steady_clock::now() + std::max<nanoseconds>(timeout, 2 * state.schedule.max_time);
+	};
+
+	std::vector<State> states(indices.size());
+	for (size_t ii = 0; ii < indices.size(); ii++) {
+		Handle::HICANNHw& h = *handles[indices[ii]];
+		set_fg_row_values(h, FGRowOnFGBlock(0), fgs[indices[ii]], true, false);
+		states[ii].row = 0;
+		states[ii].writeDown = true;
+		issued(h, states[ii]);
+	}
+
+	size_t pending = indices.size();
+	while (pending > 0) {
+		auto next_poll = steady_clock::time_point::max();
+		for (size_t ii = 0; ii < indices.size(); ii++) {
+			State& state = states[ii];
+			if (state.row == FGBlock::fg_lines)
+				continue;
+
+			Handle::HICANNHw& h = *handles[indices[ii]];
+			if (steady_clock::now() < state.schedule.next_poll) {
+				next_poll = std::min(next_poll, state.schedule.next_poll);
+				continue;
+			}
+			if (fg_is_busy(h)) {
+				auto const poll_end = steady_clock::now();
+				if (poll_end > state.end_time)
+					throw std::runtime_error("set_fg_values timeout on " + short_format(h.coordinate()));
+				state.schedule.backoff(poll_end);
+				next_poll = std::min(next_poll, state.schedule.next_poll);
+				continue;
+			}
+
+			FGErrorResultQuadRow const result = wait_fg(h);
+			for (auto const& fgb : iter_all<FGBlockOnHICANN>())
+				if (!has_error(results[indices[ii]][fgb]))
+					results[indices[ii]][fgb] = result[fgb];
+
+			// write cycle: first write down, then write up
+			if (state.writeDown) {
+				state.writeDown = false;
+				// FG RAM still holds the values of this row
+				fg_write_instruction(h, FGInstruction::writeUp(state.row));
+			} else if (++state.row < FGBlock::fg_lines) {
+				state.writeDown = true;
+				set_fg_row_values(h, FGRowOnFGBlock(state.row), fgs[indices[ii]], true, false);
+			} else {
+				--pending;
+				continue;
+			}
+			issued(h, state);
+			next_poll = std::min(next_poll, state.schedule.next_poll);
+		}
+		if (pending > 0)
+			std::this_thread::sleep_until(next_poll);
+	}
+}
+
+} // namespace
+
+HALBE_SETTER(
+	set_fg_values,
+	std::vector<boost::shared_ptr<Handle::HICANN> >, handles,
+	std::vector<FGControl> const&, fgs)
+{
+	if (fgs.size() != handles.size())
+		throw std::invalid_argument("set_fg_values: number of handles and data does not match");
+
+	std::vector<FGErrorResultQuadRow> results(handles.size());
+	for_each_reticle(handles, [&](std::vector<size_t> const& indices) {
+		schedule_fg_values(handles, indices, fgs, results);
+	});
+}
+
+std::vector<FGErrorResultQuadRow> program_fg_values(
+	std::vector<boost::shared_ptr<Handle::HICANN> > const& handles,
+	std::vector<FGControl> const& fgs)
+{
+	if (fgs.size() != handles.size())
+		throw std::invalid_argument("program_fg_values: number of handles and data does not match");
+
+	std::vector<FGErrorResultQuadRow> results(handles.size());
+
+	// Only hardware controllers can be polled, all other handles are programmed
+	// sequentially without error results.
+	std::vector<boost::shared_ptr<Handle::HICANNHw> > hw_handles;
+	std::vector<size_t> hw_indices;
+	for (size_t ii = 0; ii < handles.size(); ++ii) {
+		if (auto hw = boost::dynamic_pointer_cast<Handle::HICANNHw>(handles[ii])) {
+			hw_handles.push_back(hw);
+			hw_indices.push_back(ii);
+		} else {
+			set_fg_values(*handles[ii], fgs[ii]);
+		}
+	}
+
+	std::vector<FGControl> hw_fgs;
+	hw_fgs.reserve(hw_indices.size());
+	for (size_t const index : hw_indices)
+		hw_fgs.push_back(fgs[index]);
+
+	std::vector<FGErrorResultQuadRow> hw_results(hw_handles.size());
+	for_each_reticle(hw_handles, [&](std::vector<size_t> const& indices) {
+		schedule_fg_values(hw_handles, indices, hw_fgs, hw_results);
+	});
+
+	for (size_t ii = 0; ii < hw_indices.size(); ++ii)
+		results[hw_indices[ii]] = hw_results[ii];
+	return results;
+}
+
+FGUpdateReport update_fg_values(Handle::HICANN & h, FGControl const& fg, bool const force_full)
+{
+	size_t const rows_total = FGBlockOnHICANN::size * FGBlock::fg_lines;
+	FGUpdateReport report{rows_total, 0, std::chrono::nanoseconds(0)};
+
+	auto* const hw = dynamic_cast<Handle::HICANNHw*>(&h);
+	if (!hw) {
+		set_fg_values(h, fg);
+		return report;
+	}
+
+	auto& state = hw->fg_controller_state();
+	// programming with another configuration changes the result of unchanged values as well
+	bool const full = force_full || !state.programmed || state.programmed_config != state.config;
+
+	// rows to be programmed per FG block
+	std::array<std::vector<size_t>, FGBlockOnHICANN::size> dirty;
+	if (full) {
+		for (auto& rows : dirty) {
+			rows.resize(FGBlock::fg_lines);
+			std::iota(rows.begin(), rows.end(), 0);
+		}
+	} else {
+		dirty = fg_dirty_rows(*state.programmed, fg);
+	}
+
+	size_t steps = 0;
+	report.rows_written = 0;
+	for (auto const& rows : dirty) {
+		report.rows_written += rows.size();
+		steps = std::max(steps, rows.size());
+	}
+	report.rows_skipped = rows_total - report.rows_written;
+
+	auto const start = std::chrono::steady_clock::now();
+	for (size_t step = 0; step < steps; step++) {
+		for (auto const b : iter_all<FGBlockOnHICANN>()) {
+			auto const& rows = dirty[b.toEnum()];
+			if (step < rows.size())
+				fg_upload_row(
+				    *hw, b, rows[step], fg.getBlock(b).getFormattedRow(rows[step]), true, false);
+		}
+
+		//execute write cycle: first write down, then write up
+		for (auto const instruction : {&FGInstruction::writeDown, &FGInstruction::writeUp}) {
+			for (auto const b : iter_all<FGBlockOnHICANN>()) {
+				auto const& rows = dirty[b.toEnum()];
+				if (step < rows.size())
+					fg_write_instruction(*hw, b, instruction(rows[step], false));
+			}
+			for (auto const b : iter_all<FGBlockOnHICANN>()) {
+				auto const& rows = dirty[b.toEnum()];
+				if (step < rows.size())
+					fg_busy_wait(*hw, b, rows[step]);
+			}
+		}
+	}
+
+	if (steps)
+		state.row_time = (std::chrono::steady_clock::now() - start) / steps;
+	report.time_saved = (FGBlock::fg_lines - steps) * state.row_time;
+
+	// set after the write cycles, which discard the remembered values
+	state.programmed.reset(new FGControl(fg));
+	state.programmed_config = state.config;
+	return report;
+}
+
+void invalidate_fg_values(Handle::HICANN & h)
+{
+	if (auto* const hw = dynamic_cast<Handle::HICANNHw*>(&h))
+		hw->fg_controller_state().programmed.reset();
+}
+
 HALBE_GETTER(FGBlock, get_fg_values,
 	Handle::HICANN &, h,
 	FGBlockOnHICANN const&, b)
@@ -769,10 +1042,8 @@ HALBE_GETTER(FGRow, get_fg_ram_values,
 	ReticleControl& reticle = *h.get_reticle();
 	auto& fc = reticle.hicann[h.jtag_addr()]->getFC(b.toEnum());
 	FGRow fgr;
-	// FG values only stored on bank 0
-	// Second bank could be used to write the controller values in parallel to programming the
-	// floating gates. This feature is not implemented, therefore the second bank is never used.
-	uint32_t bank = 0;
+	// in double-buffered mode, the last upload may have been to the second bank (cf. fg_ram_access)
+	uint32_t const bank = h.fg_controller_state().ram_bank[b.toEnum()];
 	for (size_t col = 0; col < (FGRow::fg_columns + 1) / 2; col++) {
 		uint16_t addr;
 		uint32_t data;
@@ -801,44 +1072,36 @@ HALBE_GETTER(HICANN::FGErrorResultQuadRow,
 	halco::hicann::v2::FGRowOnFGBlock, row,
 	FGControl const&, fg,
 	bool const, writeDown,
-	bool const, blocking)
+	bool const, blocking,
+	bool const, double_buffered)
 {
-	ReticleControl& reticle = *h.get_reticle();
-	auto const getFC = [&h,&reticle](size_t ii) {
-		return reticle.hicann[h.jtag_addr()]->getFC(ii);
-	};
-
 	////setting analog parameters
-	std::bitset<20> data;
-	for (size_t blk = 0; blk < fg.size(); blk++) {
-		FGBlockOnHICANN b {Enum{blk}};
-		auto data = fg.getBlock(b).set_formatter(b, row);
-
-		size_t cnt = 0;
-		for (auto const& val : data)
-			// ECM: TODO later (4 pbmem-based cfg) specify delay for async write (see below too)!
-			getFC(blk).write_data(cnt++, val.to_ulong());
-	}
+	// in double-buffered mode, writing up uses the values uploaded for writing down
+	// ECM: TODO later (4 pbmem-based cfg) specify delay for async write (see below too)!
+	std::array<bool, 4> const banks = fg_upload_row(h, fg, row, writeDown, double_buffered);
 
+	// the upload overlaps with the previous write cycle, which has to finish first
+	HICANN::FGErrorResultQuadRow previous;
+	if (double_buffered)
+		previous = fg_busy_wait(h);
 
 	////issue command for writing down or up -- calling both required for arbitrary values
-	if (writeDown) {
-		//execute write cycle: first write down, then write up
-		for (size_t blk = 0; blk < 4; blk++)
-			getFC(blk).write_data(facets::FGControl::REG_ADDRINS,
-				FGInstruction::writeDown(row));
-	} else {
-		for (size_t blk = 0; blk < fg.size(); blk++)
-			getFC(blk).write_data(facets::FGControl::REG_ADDRINS,
-				FGInstruction::writeUp(row));
+	for (auto const& fgb : iter_all<FGBlockOnHICANN>()) {
+		bool const bank = banks[fgb.toEnum()];
+		if (writeDown) {
+			//execute write cycle: first write down, then write up
+			fg_write_instruction(h, fgb, FGInstruction::writeDown(row, bank));
+		} else {
+			fg_write_instruction(h, fgb, FGInstruction::writeUp(row, bank));
+		}
 	}
 
 	if (blocking)
 		// wait for all controllers to finish
 		return fg_busy_wait(h);
 
-	// No errors can be obtained when not waiting for the controller to finish.
-	return HICANN::FGErrorResultQuadRow();
+	// No errors of this write cycle can be obtained when not waiting for the controller to finish.
+	return previous;
 }
 
 HALBE_GETTER(HICANN::FGErrorResultQuadRow,
@@ -847,31 +1110,36 @@ HALBE_GETTER(HICANN::FGErrorResultQuadRow,
 	const FGRowOnFGBlock4, rows,
 	const FGRow4&, rowData,
 	bool const, writeDown,
-	bool const, blocking)
+	bool const, blocking,
+	bool const, double_buffered)
 {
-	ReticleControl& reticle = *h.get_reticle();
-
 	////setting analog parameters
-	std::bitset<20> data;
+	// in double-buffered mode, writing up uses the values uploaded for writing down
+	std::array<bool, 4> banks;
 	for (FGBlockOnHICANN blk : iter_all<FGBlockOnHICANN>()) {
-		const FGRowOnFGBlock r = rows.at(blk.toEnum());
-		auto fc = reticle.hicann[h.jtag_addr()]->getFC(blk.toEnum());
+		// ECM: TODO later (4 pbmem-based cfg) specify delay for async write (see below too)!
+		banks[blk.toEnum()] = fg_upload_row(
+			h, blk, rows.at(blk.toEnum()), rowData.at(blk.toEnum()).getFormatted(), writeDown,
+			double_buffered);
+	}
 
-		size_t cnt = 0;
-		for (auto const& val : rowData.at(blk.toEnum()).set_formatter()) {
-			// ECM: TODO later (4 pbmem-based cfg) specify delay for async write (see below too)!
-			fc.write_data(cnt++, val.to_ulong());
-		}
-		fc.write_data(
-			facets::FGControl::REG_ADDRINS,
-			(writeDown ? FGInstruction::writeDown(r) : FGInstruction::writeUp(r)));
+	// the upload overlaps with the previous write cycle, which has to finish first
+	HICANN::FGErrorResultQuadRow previous;
+	if (double_buffered)
+		previous = fg_busy_wait(h);
+
+	for (FGBlockOnHICANN blk : iter_all<FGBlockOnHICANN>()) {
+		const FGRowOnFGBlock r = rows.at(blk.toEnum());
+		bool const bank = banks[blk.toEnum()];
+		fg_write_instruction(
+			h, blk, (writeDown ? FGInstruction::writeDown(r, bank) : FGInstruction::writeUp(r, bank)));
 	}
 
 	if (blocking)
 		return fg_busy_wait(h);
 
-	// No errors can be obtained when not waiting for the controller to finish.
-	return HICANN::FGErrorResultQuadRow();
+	// No errors of this write cycle can be obtained when not waiting for the controller to finish.
+	return previous;
 }
 
 HALBE_GETTER(HICANN::FGErrorResultQuadRow,
@@ -881,35 +1149,32 @@ HALBE_GETTER(HICANN::FGErrorResultQuadRow,
 	halco::hicann::v2::FGRowOnFGBlock, row,
 	FGRow const&, fg,
 	bool const, writeDown,
-	bool const, blocking)
+	bool const, blocking,
+	bool const, double_buffered)
 {
-	ReticleControl& reticle = *h.get_reticle();
-	auto const getFC = [&h,&reticle](size_t ii) {
-		return reticle.hicann[h.jtag_addr()]->getFC(ii);
-	};
-
 	////setting analog parameters
-	size_t cnt = 0;
-	for (auto const& val : fg.set_formatter())
-		// ECM: TODO later (4 pbmem-based cfg) specify delay for async write (see below too)!
-		getFC(block.toEnum()).write_data(cnt++, val.to_ulong());
+	// in double-buffered mode, writing up uses the values uploaded for writing down
+	// ECM: TODO later (4 pbmem-based cfg) specify delay for async write (see below too)!
+	bool const bank = fg_upload_row(h, block, row, fg.getFormatted(), writeDown, double_buffered);
 
+	// the upload overlaps with the previous write cycle, which has to finish first
+	HICANN::FGErrorResultQuadRow previous;
+	if (double_buffered)
+		previous[block] = fg_busy_wait(h, block);
 
 	////issue command for writing down or up -- calling both required for arbitrary values
 	if (writeDown) {
 		//execute write cycle
-		getFC(block.toEnum()).write_data(facets::FGControl::REG_ADDRINS,
-			FGInstruction::writeDown(row));
+		fg_write_instruction(h, block, FGInstruction::writeDown(row, bank));
 	} else {
-		getFC(block.toEnum()).write_data(facets::FGControl::REG_ADDRINS,
-			FGInstruction::writeUp(row));
+		fg_write_instruction(h, block, FGInstruction::writeUp(row, bank));
 	}
 
 	if (blocking)
 		return fg_busy_wait(h);
 
-	// No errors can be obtained when not waiting for the controller to finish.
-	return HICANN::FGErrorResultQuadRow();
+	// No errors of this write cycle can be obtained when not waiting for the controller to finish.
+	return previous;
 }
 
 
@@ -926,6 +1191,9 @@ HALBE_SETTER(
 
 	fc.write_data(facets::FGControl::REG_OP,
 			config.getOp().to_ulong());
+
+	// used to predict the duration of write cycles
+	h.fg_controller_state().config[block.toEnum()] = config;
 }
 
 
@@ -1167,6 +1435,22 @@ HALBE_SETTER(
 	rc.write_data(facets::RepeaterControl::rc_config, config.to_ulong());
 }
 
+HALBE_SETTER(
+	set_repeater_block,
+	std::vector<boost::shared_ptr<Handle::HICANN> >, handles,
+	RepeaterBlockOnHICANN const&, block,
+	std::vector<HICANN::RepeaterBlock> const&, data)
+{
+	if (data.size() != handles.size())
+		throw std::invalid_argument("set_repeater_block: number of handles and data does not match");
+
+	for_each_reticle(handles, [&](std::vector<size_t> const& indices) {
+		for (size_t const index : indices) {
+			set_repeater_block(*handles[index], block, data[index]);
+		}
+	});
+}
+
 HALBE_GETTER(HICANN::RepeaterBlock, get_repeater_block,
 	Handle::HICANN &, h,
 	RepeaterBlockOnHICANN const&, block)
@@ -1230,12 +1514,19 @@ HALBE_SETTER(
 	reticle.hicann[h.jtag_addr()]->getNC().write_data(NeuronControl::nc_enable, enable.to_ulong());
 	reticle.hicann[h.jtag_addr()]->getNC().write_data(NeuronControl::nc_select, select.to_ulong());
 	reticle.hicann[h.jtag_addr()]->getNC().write_data(NeuronControl::nc_slow, slow.to_ulong());
+
+	if (auto* const shadow = enabled_shadow_state(h))
+		shadow->merger_tree = m;
 }
 
 
 HALBE_GETTER(MergerTree, get_merger_tree,
 	Handle::HICANN &, h)
 {
+	auto* const shadow = enabled_shadow_state(h);
+	if (shadow && shadow->serve_reads && shadow->merger_tree)
+		return *shadow->merger_tree;
+
 	ReticleControl& reticle = *h.get_reticle();
 
 	MergerTree returnvalue;
@@ -1262,6 +1553,9 @@ HALBE_GETTER(MergerTree, get_merger_tree,
 		returnvalue.getMergerRaw(mer).config[Merger::enable_bit] = enable[translate_neuron_merger(mer)];
 		returnvalue.getMergerRaw(mer).slow = slow[translate_neuron_merger(mer)];
 	}
+
+	if (shadow)
+		shadow->merger_tree = returnvalue;
 	return returnvalue;
 }
 
@@ -1761,6 +2055,9 @@ HALBE_SETTER(
 	set_stdp_lut(h, synarray, synapse_controller.lut);
 	set_syn_rst(h, synarray, synapse_controller.syn_rst);
 	set_syn_ctrl(h, synarray, synapse_controller.ctrl_reg);
+
+	if (auto* const shadow = enabled_shadow_state(h))
+		shadow->synapse_controllers[synarray] = synapse_controller;
 }
 
 HALBE_GETTER(SynapseController, get_synapse_controller,
@@ -1828,8 +2125,276 @@ HALBE_SETTER(
 	HicannCtrl& hc = *reticle.hicann[h.jtag_addr()];
 
 	hicann_init(hc, zero_synapses);
+
+	// the configuration has been reset
+	h.shadow_state().clear();
+}
+
+
+void set_shadow_mode(Handle::HICANN & h, ShadowMode const mode)
+{
+	if (auto* const hw = dynamic_cast<Handle::HICANNHw*>(&h))
+		set_shadow_mode(hw->shadow_state(), mode);
+}
+
+ShadowMode get_shadow_mode(Handle::HICANN & h)
+{
+	auto* const hw = dynamic_cast<Handle::HICANNHw*>(&h);
+	return hw ? get_shadow_mode(hw->shadow_state()) : ShadowMode::disabled;
+}
+
+bool ShadowVerifyReport::ok() const
+{
+	return mismatches.empty();
 }
 
+namespace {
+
+template <typename Key, typename Value, typename Read>
+void verify_shadow_entries(
+	std::map<Key, Value> const& cached, char const* const name, Read const& read,
+	ShadowVerifyReport& report)
+{
+	for (auto const& entry : cached) {
+		report.checked++;
+		if (read(entry.first) != entry.second) {
+			std::stringstream ss;
+			ss << name << " of " << entry.first << " differ from hardware";
+			report.mismatches.push_back(ss.str());
+		}
+	}
+}
+
+} // namespace
+
+ShadowVerifyReport verify_shadow_state(Handle::HICANN & h)
+{
+	ShadowVerifyReport report{0, {}};
+	auto* const hw = dynamic_cast<Handle::HICANNHw*>(&h);
+	if (!hw)
+		return report;
+
+	// read back from the hardware with the cache disabled, i.e. without altering it
+	auto& shadow = hw->shadow_state();
+	Handle::HICANNHw::ShadowState cached;
+	std::swap(cached, shadow);
+	try {
+		auto const& controllers = cached.synapse_controllers;
+		verify_shadow_entries(
+		    cached.weights, "weights", [&](SynapseRowOnHICANN const& row) {
+			    return get_weights_row(h, controllers.at(row.toSynapseArrayOnHICANN()), row);
+		    }, report);
+		verify_shadow_entries(
+		    cached.decoders, "decoders", [&](SynapseDriverOnHICANN const& drv) {
+			    return get_decoder_double_row(h, controllers.at(drv.toSynapseArrayOnHICANN()), drv);
+		    }, report);
+
+		for (auto const& entry : cached.crossbar) {
+			report.checked++;
+			if (get_crossbar_switch_row(h, entry.first.first, entry.first.second) != entry.second) {
+				std::stringstream ss;
+				ss << "crossbar switches of " << entry.first.first << " (" << entry.first.second
+				   << ") differ from hardware";
+				report.mismatches.push_back(ss.str());
+			}
+		}
+
+		if (cached.merger_tree) {
+			report.checked++;
+			if (get_merger_tree(h) != *cached.merger_tree)
+				report.mismatches.push_back("merger tree differs from hardware");
+		}
+	} catch (...) {
+		std::swap(cached, shadow);
+		throw;
+	}
+	std::swap(cached, shadow);
+	return report;
+}
+
+ConfigDiffStatistics upload_config_diff(
+	Handle::HICANN & h,
+	SparseConfiguration const& previous,
+	SparseConfiguration const& next)
+{
+	SparseConfiguration const changed = diff(previous, next);
+
+	auto const controller = [&next](SynapseArrayOnHICANN const& synarray) -> SynapseController const& {
+		auto const it = next.synapse_controllers.find(synarray);
+		if (it == next.synapse_controllers.end()) {
+			std::stringstream ss;
+			ss << "upload_config_diff: no synapse controller for " << synarray;
+			throw std::invalid_argument(ss.str());
+		}
+		return it->second;
+	};
+
+	auto const start = std::chrono::steady_clock::now();
+	for (auto const& entry : changed.synapse_controllers)
+		set_synapse_controller(h, entry.first, entry.second);
+	for (auto const& entry : changed.weights)
+		set_weights_row(h, controller(entry.first.toSynapseArrayOnHICANN()), entry.first, entry.second);
+	for (auto const& entry : changed.decoders)
+		set_decoder_double_row(
+		    h, controller(entry.first.toSynapseArrayOnHICANN()), entry.first, entry.second);
+	for (auto const& entry : changed.crossbar_switches)
+		set_crossbar_switch_row(h, entry.first.first, entry.first.second, entry.second);
+	for (auto const& entry : changed.syndriver_switches)
+		set_syndriver_switch_row(h, entry.first, entry.second);
+	for (auto const& entry : changed.horizontal_repeaters)
+		set_repeater(h, entry.first, entry.second);
+	for (auto const& entry : changed.vertical_repeaters)
+		set_repeater(h, entry.first, entry.second);
+	for (auto const& entry : changed.neuron_quads)
+		set_denmem_quad(h, entry.first, entry.second);
+	auto const time = std::chrono::steady_clock::now() - start;
+
+	ConfigDiffStatistics statistics;
+	statistics.rows_written = changed.rows();
+	statistics.rows_skipped = next.rows() - changed.rows();
+	statistics.words_written = changed.words();
+	statistics.words_skipped = next.words() - changed.words();
+	statistics.time = std::chrono::duration_cast<std::chrono::nanoseconds>(time);
+	statistics.time_saved = std::chrono::nanoseconds(0);
+	if (statistics.words_written)
+		statistics.time_saved =
+		    statistics.time * statistics.words_skipped / statistics.words_written;
+	return statistics;
+}
+
+double SynapseArrayUploadStatistics::words_per_second() const
+{
+	if (time.count() == 0)
+		return 0.;
+	return words / std::chrono::duration<double>(time).count();
+}
+
+double SynapseArrayUploadStatistics::synapse_controller_utilization() const
+{
+	return words_per_second() / synapse_controller_words_per_second;
+}
+
+double SynapseArrayUploadStatistics::host_link_utilization() const
+{
+	if (host_link_words_per_second == 0.)
+		return 0.;
+	return words_per_second() / host_link_words_per_second;
+}
+
+SynapseArrayUploadStatistics set_synapse_array(
+	Handle::HICANN & h,
+	SynapseController const& synapse_controller,
+	SynapseArrayOnHICANN const& synarray,
+	SynapseWeightMatrix const& weights,
+	SynapseDecoderMatrix const& decoders)
+{
+	SynapseArrayUploadStatistics statistics{0, 0, 0, 0, 0., std::chrono::nanoseconds(0)};
+
+	std::vector<SynapseRowOnHICANN> rows;
+	for (auto const row : iter_all<SynapseRowOnHICANN>())
+		if (row.toSynapseArrayOnHICANN() == synarray)
+			rows.push_back(row);
+	std::vector<SynapseDriverOnHICANN> drivers;
+	for (auto const drv : iter_all<SynapseDriverOnHICANN>())
+		if (drv.toSynapseArrayOnHICANN() == synarray)
+			drivers.push_back(drv);
+
+	// each column set of 4 SYNIN words is followed by its command (cf. append_weights_row_writes)
+	size_t const synin_words_per_command = 4;
+	statistics.data_words = rows.size() * SparseConfiguration::words_per_weights_row +
+	                        drivers.size() * SparseConfiguration::words_per_decoder_double_row;
+	statistics.command_words = statistics.data_words / synin_words_per_command;
+
+	auto* const hw = dynamic_cast<Handle::HICANNHw*>(&h);
+	if (hw) {
+		statistics.host_link_words_per_second =
+		    hw->highspeed()
+		        ? SynapseArrayUploadStatistics::arq_words_per_second
+		        : PowerBackend::shared()->jtag_frequency(hw->coordinate().toDNCGlobal()).value() /
+		              SynapseArrayUploadStatistics::jtag_bits_per_word;
+	}
+
+	if (!hw || hw->synapse_controller_state().poll_status) {
+		// guarding packets are counted by wait_by_dummy
+		size_t guards_before = 0;
+		if (hw)
+			guards_before =
+			    hw->synapse_controller_state().dummy_writes + hw->synapse_controller_state().polls;
+
+		auto const start = std::chrono::steady_clock::now();
+		for (auto const row : rows)
+			set_weights_row(h, synapse_controller, row, weights[row]);
+		for (auto const drv : drivers)
+			set_decoder_double_row(h, synapse_controller, drv, decoders[drv]);
+		statistics.time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+		    std::chrono::steady_clock::now() - start);
+
+		if (hw)
+			statistics.guard_words = hw->synapse_controller_state().dummy_writes +
+			                         hw->synapse_controller_state().polls - guards_before;
+		statistics.words =
+		    statistics.data_words + statistics.command_words + statistics.guard_words;
+		return statistics;
+	}
+
+	// format everything up front...
+	synapse_controller_writes_t writes;
+	for (auto const row : rows)
+		append_weights_row_writes(writes, synapse_controller, row, weights[row]);
+	for (auto const drv : drivers)
+		append_decoder_double_row_writes(writes, synapse_controller, drv, decoders[drv]);
+	// dummy writes are the only writes of the configuration register
+	statistics.guard_words = std::count_if(
+	    writes.begin(), writes.end(), [](std::pair<uint32_t, uint32_t> const& write) {
+		    return write.first == facets::SynapseControl::sc_cnfgreg;
+	    });
+	statistics.words = writes.size();
+	assert(statistics.words ==
+	       statistics.data_words + statistics.command_words + statistics.guard_words);
+
+	// ...and stream it without any further processing
+	ReticleControl& reticle = *hw->get_reticle();
+	SynapseControl& sc = reticle.hicann[hw->jtag_addr()]->getSC(
+	    synarray.isTop() ? HicannCtrl::SYNAPSE_TOP : HicannCtrl::SYNAPSE_BOTTOM);
+
+	auto const start = std::chrono::steady_clock::now();
+	for (auto const& write : writes)
+		sc.write_data(write.first, write.second);
+	statistics.time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+	    std::chrono::steady_clock::now() - start);
+	hw->synapse_controller_state().dummy_writes += statistics.guard_words;
+
+	LOG4CXX_DEBUG(logger, short_format(h.coordinate()) << " " << synarray << ": wrote "
+	                      << statistics.words << " words (" << statistics.data_words
+	                      << " data words) at " << statistics.words_per_second() << " words/s, "
+	                      << statistics.host_link_utilization() * 100 << "% of the host link");
+
+	if (auto* const shadow = enabled_shadow_state(*hw)) {
+		for (auto const row : rows)
+			shadow->weights[row] = weights[row];
+		for (auto const drv : drivers)
+			shadow->decoders[drv] = decoders[drv];
+		shadow->synapse_controllers[synarray] = synapse_controller;
+	}
+	return statistics;
+}
+
+void set_synapse_wait_mode(Handle::HICANN & h, SynapseWaitMode const mode)
+{
+	auto* const hw = dynamic_cast<Handle::HICANNHw*>(&h);
+	if (!hw)
+		return;
+
+	hw->synapse_controller_state().poll_status = mode == SynapseWaitMode::status_polling;
+}
+
+SynapseWaitMode get_synapse_wait_mode(Handle::HICANN & h)
+{
+	auto* const hw = dynamic_cast<Handle::HICANNHw*>(&h);
+	if (!hw || !hw->synapse_controller_state().poll_status)
+		return SynapseWaitMode::dummy_writes;
+	return SynapseWaitMode::status_polling;
+}
 
 HALBE_GETTER(Status, get_hicann_status,
 	Handle::HICANN &, h)
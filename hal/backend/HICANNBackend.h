@@ -1,9 +1,17 @@
 #pragma once
 
+#include <chrono>
+#include <string>
+#include <vector>
+
 #include <boost/shared_ptr.hpp>
 
 #include "halco/hicann/v2/fwd.h"
 #include "hal/HICANN.h"
+#ifndef PYPLUSPLUS
+#include "halco/common/typed_array.h"
+#include "hal/HICANN/SparseConfiguration.h"
+#endif
 
 namespace HMF {
 
@@ -150,6 +158,21 @@ void set_synapse_driver(
 	halco::hicann::v2::SynapseDriverOnHICANN const& s,
 	SynapseDriver const& drv_row);
 
+#ifndef PYPLUSPLUS
+/**
+ * HICANN-parallel "synapse driver" setter to optimize writing speed.
+ *
+ * The vector parameters correspond to the scalar function's parameters (cf. above).
+ *
+ * @notice Performance-optimized function has not been exposed to Python.
+ */
+void set_synapse_driver(
+	std::vector<boost::shared_ptr<Handle::HICANN> > handles,
+	std::vector<SynapseController> const& synapse_controllers,
+	halco::hicann::v2::SynapseDriverOnHICANN const& s,
+	std::vector<SynapseDriver> const& data);
+#endif // !PYPLUSPLUS
+
 SynapseDriver get_synapse_driver(
 	Handle::HICANN & h,
 	SynapseController const& synapse_controller,
@@ -204,16 +227,117 @@ NeuronConfig get_neuron_config(Handle::HICANN & h);
 HICANN::FGErrorResultRow wait_fg(Handle::HICANN & h, halco::hicann::v2::FGBlockOnHICANN const & b);
 HICANN::FGErrorResultQuadRow wait_fg(Handle::HICANN & h);
 
+#ifndef PYPLUSPLUS
+/// Statistics of the status reads while waiting for the floating gate controllers.
+struct FGWaitStatistics
+{
+	/// Number of awaited write cycles (per FG block)
+	size_t write_cycles;
+	/// Number of status reads
+	size_t polls;
+	/// Time spent on status reads, i.e. occupying the link
+	std::chrono::nanoseconds poll_time;
+	/// Total time spent waiting for the controllers
+	std::chrono::nanoseconds wait_time;
+
+	double polls_per_write_cycle() const;
+};
+
+/**
+ * Returns the statistics accumulated since the creation of the handle or the last reset.
+ *
+ * The status of the controllers is polled with an adaptive delay derived from the FGConfig
+ * last set via set_fg_config, i.e. the statistics allow to assess the link load caused by
+ * waiting.
+ *
+ * @note Statistics of non-hardware handles are always empty.
+ * @notice Diagnostic function has not been exposed to Python.
+ */
+FGWaitStatistics get_fg_wait_statistics(Handle::HICANN & h);
+void reset_fg_wait_statistics(Handle::HICANN & h);
+#endif // !PYPLUSPLUS
+
 /**
  * Sets both analog floating gate values and FG configuration for the FG blocks.
  *
  * @param fg   Data struct
+ * @param double_buffered if true the values of the next row are uploaded to the other RAM
+ *        bank of the controllers while the current row is programmed
  *
  * @note As the FGBlockOnHICANN struct has the FGBlockOnHICANN coordinate, it is not neccessary to
  *       give it to the function. Use FGControl::extract_block to get FGBlockOnHICANN right
  */
-void set_fg_values(Handle::HICANN & h, halco::hicann::v2::FGBlockOnHICANN const& b, FGBlock const& fgb);
-void set_fg_values(Handle::HICANN & h, FGControl const& fg);
+void set_fg_values(
+	Handle::HICANN & h,
+	halco::hicann::v2::FGBlockOnHICANN const& b,
+	FGBlock const& fgb,
+	bool const double_buffered = false);
+void set_fg_values(Handle::HICANN & h, FGControl const& fg, bool const double_buffered = false);
+
+#ifndef PYPLUSPLUS
+/**
+ * HICANN-parallel "FG values" setter to optimize writing speed.
+ *
+ * The vector parameters correspond to the scalar function's parameters (cf. above).
+ * The HICANNs are scheduled as for program_fg_values, error results are discarded.
+ *
+ * @notice Performance-optimized function has not been exposed to Python.
+ */
+void set_fg_values(
+	std::vector<boost::shared_ptr<Handle::HICANN> > handles,
+	std::vector<FGControl> const& fgs);
+
+/**
+ * Programs the FG values of many HICANNs concurrently.
+ *
+ * The FG controllers of all HICANNs are polled and each HICANN that has
+ * finished its write cycle is issued the next one (cf. non-blocking
+ * set_fg_row_values and wait_fg).  HICANNs on different reticles are
+ * handled in parallel threads.  Hence, the total programming time is about
+ * the one of the slowest HICANN instead of the sum over all HICANNs.
+ *
+ * @param fgs Data struct for each handle
+ * @return Error results for each handle: per FG block the result of the first
+ *         erroneous write cycle, otherwise the one of the last write cycle.
+ *         Non-hardware handles are programmed sequentially and yield no-error results.
+ *
+ * @notice Performance-optimized function has not been exposed to Python.
+ */
+std::vector<FGErrorResultQuadRow> program_fg_values(
+	std::vector<boost::shared_ptr<Handle::HICANN> > const& handles,
+	std::vector<FGControl> const& fgs);
+
+/// Outcome of an incremental FG update (cf. update_fg_values).
+struct FGUpdateReport
+{
+	/// Number of rows (summed over all FG blocks) that have been programmed
+	size_t rows_written;
+	/// Number of rows (summed over all FG blocks) skipped as unchanged
+	size_t rows_skipped;
+	/// Estimated programming time saved by skipping rows
+	std::chrono::nanoseconds time_saved;
+};
+
+/**
+ * Programs only the FG rows that differ from the values last programmed via this function.
+ *
+ * The values are remembered per handle.  Any other FG write cycle issued to the handle
+ * (e.g. set_fg_values, set_fg_row_values) or invalidate_fg_values discards them, i.e. the
+ * next update programs all rows.  All rows are programmed as well if the FG configuration
+ * (cf. set_fg_config) changed since the last update.  The k-th changed row of all FG blocks is programmed
+ * concurrently, hence the time saved is estimated from the number of skipped write cycles
+ * and the measured duration of a write cycle.
+ *
+ * @param force_full program all rows regardless of the remembered values
+ * @note The FG values of non-hardware handles are always set completely.
+ * @notice Performance-optimized function has not been exposed to Python.
+ */
+FGUpdateReport update_fg_values(Handle::HICANN & h, FGControl const& fg, bool force_full = false);
+
+/// Discards the values remembered by update_fg_values, e.g. after a reset of the chip.
+void invalidate_fg_values(Handle::HICANN & h);
+#endif // !PYPLUSPLUS
+
 FGBlock get_fg_values(Handle::HICANN & h, halco::hicann::v2::FGBlockOnHICANN const& b);
 
 /**
@@ -234,7 +358,8 @@ void set_fg_ram_values(
  *
  * @param h HICANN handle
  * @param b FGBlock where controller is located
- * @note Only the first of the two available FG value registers is read
+ * @note Of the two available FG value registers, the one last uploaded to is read, i.e. the
+ *       second one only after uploads in double-buffered mode (cf. set_fg_row_values)
  * @return Read row of FG values transformed into FGRow struct
  */
 FGRow get_fg_ram_values(Handle::HICANN& h, halco::hicann::v2::FGBlockOnHICANN const& b);
@@ -246,17 +371,26 @@ FGRow get_fg_ram_values(Handle::HICANN& h, halco::hicann::v2::FGBlockOnHICANN co
  * @param fg   Data struct
  * @param writeDown if true write FG down, otherwise up
  * @param blocking  if true wait for fg controller getting idle
+ * @param double_buffered if true the values are uploaded to the RAM bank not used by the
+ *        last upload, see note below
  *
  * @note As the FGBlockOnHICANN struct has the FGBlockOnHICANN coordinate, it is not neccessary to
  *       give it to the function. Use FGControl::extract_block to get FGBlockOnHICANN right.
  * @note When using non-blocking mode make sure to call wait_fg(h) before
  *       continuing with next row. [ECM: This will change when writing via pbmem.]
+ * @note In double-buffered mode the values are uploaded while the previous write cycle (from
+ *       the other RAM bank) may still be running; the controller is awaited only before issuing
+ *       the instruction, hence the next row can be passed without calling wait_fg(h) first.
+ *       In this case the errors of that previous write cycle are returned if non-blocking.
+ *       Writing up reuses the values uploaded for writing down the same row, if no other
+ *       row has been uploaded since. Hence, rows may be written in any order.
  *
  * @return FG controller error results for all 4 rows of the 4 blocks (if
  *         blocking == true, else no-error result))
  */
 HICANN::FGErrorResultQuadRow set_fg_row_values(Handle::HICANN & h, halco::hicann::v2::FGRowOnFGBlock row,
-	FGControl const& fg, bool const writeDown, bool const blocking = true);
+	FGControl const& fg, bool const writeDown, bool const blocking = true,
+	bool const double_buffered = false);
 
 /**
  * Writes floating gate values for different rows on all blocks in parallel
@@ -265,18 +399,27 @@ HICANN::FGErrorResultQuadRow set_fg_row_values(Handle::HICANN & h, halco::hicann
  * @param data fg_values for the 4 blocks
  * @param writeDown if true write FG down, otherwise up
  * @param blocking  if true wait for fg controller getting idle
+ * @param double_buffered if true the values are uploaded to the RAM bank not used by the
+ *        last upload, see note below
  *
  * @note As the FGBlockOnHICANN struct has the FGBlockOnHICANN coordinate, it is not neccessary to
  *       give it to the function. Use FGControl::extract_block to get FGBlockOnHICANN right.
  * @note When using non-blocking mode make sure to call wait_fg(h) before
  *       continuing with next row. [ECM: This will change when writing via pbmem.]
+ * @note In double-buffered mode the values are uploaded while the previous write cycle (from
+ *       the other RAM bank) may still be running; the controller is awaited only before issuing
+ *       the instruction, hence the next row can be passed without calling wait_fg(h) first.
+ *       In this case the errors of that previous write cycle are returned if non-blocking.
+ *       Writing up reuses the values uploaded for writing down the same row, if no other
+ *       row has been uploaded since. Hence, rows may be written in any order.
  */
 HICANN::FGErrorResultQuadRow set_fg_row_values(
 	Handle::HICANN & h,
 	FGRowOnFGBlock4 rows,
 	FGRow4 const& data,
 	bool const writeDown,
-	bool const blocking = true);
+	bool const blocking = true,
+	bool const double_buffered = false);
 
 /**
  * Writes floating gate values for a row on all blocks on a single block
@@ -286,18 +429,27 @@ HICANN::FGErrorResultQuadRow set_fg_row_values(
  * @param fg   Data struct
  * @param writeDown if true write FG down, otherwise up
  * @param blocking  if true wait for fg controller getting idle
+ * @param double_buffered if true the values are uploaded to the RAM bank not used by the
+ *        last upload, see note below
  *
  * @note As the FGBlockOnHICANN struct has the FGBlockOnHICANN coordinate, it is not neccessary to
  *       give it to the function. Use FGControl::extract_block to get FGBlockOnHICANN right.
  * @note When using non-blocking mode make sure to call wait_fg(h) before
  *       continuing with next row. [ECM: This will change when writing via pbmem.]
+ * @note In double-buffered mode the values are uploaded while the previous write cycle (from
+ *       the other RAM bank) may still be running; the controller is awaited only before issuing
+ *       the instruction, hence the next row can be passed without calling wait_fg(h) first.
+ *       In this case the errors of that previous write cycle are returned if non-blocking.
+ *       Writing up reuses the values uploaded for writing down the same row, if no other
+ *       row has been uploaded since. Hence, rows may be written in any order.
  *
  * @return FG controller error results for all 4 rows of the 4 blocks (if
  *         blocking == true, else no-error result))
  */
 HICANN::FGErrorResultQuadRow set_fg_row_values(Handle::HICANN & h,
 	halco::hicann::v2::FGBlockOnHICANN block, halco::hicann::v2::FGRowOnFGBlock row,
-	FGRow const& fg, bool const writeDown, bool const blocking = true);
+	FGRow const& fg, bool const writeDown, bool const blocking = true,
+	bool const double_buffered = false);
 
 // TODO change to something like:
 // void set_fg_values(Handle::HICANN & h, halco::hicann::v2::FGBlockOnHICANN const& addr, FGControll );
@@ -378,6 +530,20 @@ void set_repeater_block(
 	halco::hicann::v2::RepeaterBlockOnHICANN const& addr,
 	RepeaterBlock const& rbc);
 
+#ifndef PYPLUSPLUS
+/**
+ * HICANN-parallel "repeater block" setter to optimize writing speed.
+ *
+ * The vector parameters correspond to the scalar function's parameters (cf. above).
+ *
+ * @notice Performance-optimized function has not been exposed to Python.
+ */
+void set_repeater_block(
+	std::vector<boost::shared_ptr<Handle::HICANN> > handles,
+	halco::hicann::v2::RepeaterBlockOnHICANN const& addr,
+	std::vector<RepeaterBlock> const& data);
+#endif // !PYPLUSPLUS
+
 
 /**
  * Fetches the results of the test input an the full flags. Returns them
@@ -669,6 +835,184 @@ void flush(Handle::HICANN& f);
 void init(Handle::HICANN & h, bool const zero_synapses = true);
 
 
+#ifndef PYPLUSPLUS
+/// Usage of the shadow state of a handle (cf. set_shadow_mode).
+enum class ShadowMode
+{
+	/// no caching, all getters access the hardware
+	disabled,
+	/// setters and getters update the shadow state, getters access the hardware
+	write_through,
+	/// as write_through, but getters answer from the shadow state if possible
+	cached_reads
+};
+
+/**
+ * Enables a write-through cache of the configuration written via this handle.
+ *
+ * Cached are synapse weights and decoders, crossbar switches and the merger
+ * tree (cf. get_weights_row, get_decoder_double_row, get_crossbar_switch_row,
+ * get_merger_tree).  Disabling the cache drops its content, as do init and
+ * FPGA::reset.  Values written behind the back of the handle (e.g. by another
+ * process or via the raw controllers) are not tracked; use verify_shadow_state
+ * to detect those.
+ *
+ * @note The mode of non-hardware handles is always disabled.
+ * @notice Performance-optimized function has not been exposed to Python.
+ */
+void set_shadow_mode(Handle::HICANN & h, ShadowMode mode);
+ShadowMode get_shadow_mode(Handle::HICANN & h);
+
+/// Outcome of verify_shadow_state.
+struct ShadowVerifyReport
+{
+	/// Number of cached entries compared with the hardware
+	size_t checked;
+	/// Description of each entry differing from the hardware
+	std::vector<std::string> mismatches;
+
+	bool ok() const;
+};
+
+/**
+ * Reads back all cached entries from the hardware and compares them with the cache.
+ *
+ * The cache is left untouched, i.e. mismatching entries keep their cached value.
+ * Cached synapse rows are read using the synapse controller last passed for
+ * their synapse array.
+ *
+ * @notice Diagnostic function has not been exposed to Python.
+ */
+ShadowVerifyReport verify_shadow_state(Handle::HICANN & h);
+
+/// Outcome of upload_config_diff.
+struct ConfigDiffStatistics
+{
+	/// Number of entries (rows or registers) written rsp. skipped as unchanged
+	size_t rows_written;
+	size_t rows_skipped;
+	/// Number of SRAM words (or registers) written rsp. skipped as unchanged
+	size_t words_written;
+	size_t words_skipped;
+	/// Time spent writing
+	std::chrono::nanoseconds time;
+	/// Estimated time saved, extrapolated from the time per written word
+	std::chrono::nanoseconds time_saved;
+};
+
+/**
+ * Reconfigures a HICANN configured with previous to next by writing only the
+ * entries that differ (cf. diff).
+ *
+ * Synapse controllers are written first.  Weights and decoders are written
+ * using the synapse controller of their array in next.
+ *
+ * @throws std::invalid_argument if next lacks the synapse controller for changed
+ *         weights or decoders.
+ * @notice Performance-optimized function has not been exposed to Python.
+ */
+ConfigDiffStatistics upload_config_diff(
+	Handle::HICANN & h,
+	SparseConfiguration const& previous,
+	SparseConfiguration const& next);
+
+/// Weights of all synapse rows, cf. set_synapse_array
+typedef halco::common::typed_array<WeightRow, halco::hicann::v2::SynapseRowOnHICANN>
+	SynapseWeightMatrix;
+/// Decoders of all synapse driver double rows, cf. set_synapse_array
+typedef halco::common::typed_array<DecoderDoubleRow, halco::hicann::v2::SynapseDriverOnHICANN>
+	SynapseDecoderMatrix;
+
+/// Outcome of set_synapse_array.
+struct SynapseArrayUploadStatistics
+{
+	/**
+	 * Upper limit of packets accepted by a synapse controller per second, i.e. one packet
+	 * per two HICANN clock cycles at 100 MHz (cf. wait_by_dummy).
+	 */
+	static constexpr double synapse_controller_words_per_second = 50e6;
+	/**
+	 * Upper limit of packets per second sent to highspeed HICANNs via the host ARQ,
+	 * i.e. 64 bit words over Gigabit Ethernet without frame overhead.
+	 */
+	static constexpr double arq_words_per_second = 1e9 / 64;
+	/// Lower limit of bits shifted per packet sent via JTAG, not counting instructions
+	static constexpr double jtag_bits_per_word = 64;
+
+	/// Number of SYNIN words written
+	size_t data_words;
+	/// Number of commands written to the control register, one per column set
+	size_t command_words;
+	/// Number of packets guarding the commands, i.e. dummy writes rsp. status reads
+	size_t guard_words;
+	/// Number of packets sent, i.e. data words, commands and guarding packets
+	size_t words;
+	/**
+	 * Upper limit of packets per second of the host link to the HICANN, i.e.
+	 * arq_words_per_second for highspeed HICANNs, else the JTAG frequency divided
+	 * by jtag_bits_per_word.  Zero for non-hardware handles.
+	 */
+	double host_link_words_per_second;
+	/// Time spent writing
+	std::chrono::nanoseconds time;
+
+	/// Achieved rate of packets
+	double words_per_second() const;
+	/// Fraction of synapse_controller_words_per_second achieved
+	double synapse_controller_utilization() const;
+	/// Fraction of host_link_words_per_second achieved, zero if the limit is unknown
+	double host_link_utilization() const;
+};
+
+/**
+ * Writes the weights and decoders of all rows of a synapse array.
+ *
+ * In contrast to calling set_weights_row and set_decoder_double_row for each
+ * row, all SYNIN words, commands and guarding dummy packets are formatted up front
+ * and streamed to the synapse controller as one sequence.  Only the entries
+ * belonging to synarray are written.
+ *
+ * @note Non-hardware handles, and handles waiting by status polling (cf.
+ *       set_synapse_wait_mode), fall back to the row-wise setters.  Packets
+ *       are counted alike on both paths; non-hardware handles send no
+ *       guarding packets.
+ * @notice Performance-optimized function has not been exposed to Python.
+ */
+SynapseArrayUploadStatistics set_synapse_array(
+	Handle::HICANN & h,
+	SynapseController const& synapse_controller,
+	halco::hicann::v2::SynapseArrayOnHICANN const& synarray,
+	SynapseWeightMatrix const& weights,
+	SynapseDecoderMatrix const& decoders);
+
+/// Waiting for synapse controller commands (cf. set_synapse_wait_mode).
+enum class SynapseWaitMode
+{
+	/// write the configuration register as often as needed to pass the timing at 100 MHz
+	dummy_writes,
+	/// read the status register until slice_busy and syndrv_busy are cleared
+	status_polling
+};
+
+/**
+ * Selects how the synapse controller commands (e.g. of set_weights_row or
+ * set_synapse_driver) are guarded.
+ *
+ * Dummy writes send one packet per two cycles of the command, i.e. tens of
+ * packets per command for slow SRAM timings, but never block on the link.
+ * Status polling reads the status register until the command is done, each
+ * read waiting for its answer, i.e. costs at least one round trip per command.
+ * It pays off for long commands or if link bandwidth is shared with other
+ * traffic.  The auto_busy flag of a running STDP auto-update is ignored.
+ *
+ * @note The mode of non-hardware handles is always dummy_writes.
+ * @notice Performance-optimized function has not been exposed to Python.
+ */
+void set_synapse_wait_mode(Handle::HICANN & h, SynapseWaitMode mode);
+SynapseWaitMode get_synapse_wait_mode(Handle::HICANN & h);
+#endif // !PYPLUSPLUS
+
+
 /**
  * Prepare HICANN for an experiment.
  * To be called after configuring the HICANN.
@@ -1,6 +1,11 @@
+#include <algorithm>
 #include <iostream>
 #include <chrono>
 #include <cmath>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <thread>
 #include "halco/hicann/v2/format_helper.h"
 #include "hal/backend/HICANNBackendHelper.h"
 #include "hal/HICANN/FGInstruction.h"
@@ -28,6 +33,127 @@ static log4cxx::LoggerPtr logger = log4cxx::Logger::getLogger("halbe.backend.hic
 namespace HMF {
 namespace HICANN {
 
+namespace {
+
+facets::HicannCtrl::Synapse to_synapse_controller(SynapseArrayOnHICANN const& synarray)
+{
+	return synarray.isTop() ? facets::HicannCtrl::SYNAPSE_TOP : facets::HicannCtrl::SYNAPSE_BOTTOM;
+}
+
+/// sets the control register like set_syn_ctrl, but without dispatch
+void write_syn_ctrl(
+    Handle::HICANNHw& h,
+    SynapseArrayOnHICANN const& synarray,
+    SynapseControlRegister const& ctrl_reg)
+{
+	std::bitset<32> ctrl_bitset;
+	synapse_ctrl_formater(ctrl_reg, synarray, ctrl_bitset);
+	h.get_reticle()->hicann[h.jtag_addr()]->getSC(to_synapse_controller(synarray)).write_data(
+	    facets::SynapseControl::sc_ctrlreg, ctrl_bitset.to_ulong());
+}
+
+/// rows of the synapse driver and decoder addresses in convenient format for hardware write
+void format_decoder_double_row(
+    SynapseDriverOnHICANN const& s,
+    HMF::HICANN::DecoderDoubleRow const& data,
+    typed_array<SynapseRowOnHICANN, RowOnSynapseDriver>& rows,
+    typed_array<std::array<std::bitset<32>, 32>, RowOnSynapseDriver>& hwdata)
+{
+	if (s.toSynapseArrayOnHICANN().isTop()) {
+		rows = {SynapseRowOnHICANN(s, RowOnSynapseDriver(top)), SynapseRowOnHICANN(s, RowOnSynapseDriver(bottom))};
+		hwdata = {top_to_decoder(data[top], data[bottom]), bot_to_decoder(data[top], data[bottom])};
+	} else {
+		rows = {SynapseRowOnHICANN(s, RowOnSynapseDriver(bottom)), SynapseRowOnHICANN(s, RowOnSynapseDriver(top))};
+		hwdata = {top_to_decoder(data[bottom], data[top]), bot_to_decoder(data[bottom], data[top])};
+	}
+}
+
+/// generate correctly formatted data for the hardware
+std::array<std::bitset<32>, 32> format_weights_row(HMF::HICANN::WeightRow const& weights)
+{
+	std::array<std::bitset<32>, 32> hwdata;
+	for (size_t i = 0; i < 32; i++)
+		hwdata[i] = bit::concat(
+		    weights[8 * i + 0].format(), weights[8 * i + 1].format(), weights[8 * i + 2].format(),
+		    weights[8 * i + 3].format(), weights[8 * i + 4].format(), weights[8 * i + 5].format(),
+		    weights[8 * i + 6].format(), weights[8 * i + 7].format());
+	return hwdata;
+}
+
+/// appends the write of the control register and the dummy writes guarding the command
+void append_syn_ctrl_and_guard(
+    synapse_controller_writes_t& writes,
+    SynapseArrayOnHICANN const& synarray,
+    SynapseController const& command,
+    std::bitset<32> const& cnfg_bitset)
+{
+	std::bitset<32> ctrl_bitset;
+	synapse_ctrl_formater(command.ctrl_reg, synarray, ctrl_bitset);
+	writes.emplace_back(facets::SynapseControl::sc_ctrlreg, ctrl_bitset.to_ulong());
+	writes.insert(
+	    writes.end(), num_dummy_waits(command.cycles_synarray(command.ctrl_reg.cmd)),
+	    std::make_pair(
+	        static_cast<uint32_t>(facets::SynapseControl::sc_cnfgreg),
+	        static_cast<uint32_t>(cnfg_bitset.to_ulong())));
+}
+
+} // namespace
+
+void append_weights_row_writes(
+    synapse_controller_writes_t& writes,
+    SynapseController const& synapse_controller,
+    SynapseRowOnHICANN const& s,
+    HMF::HICANN::WeightRow const& weights)
+{
+	std::array<std::bitset<32>, 32> const hwdata = format_weights_row(weights);
+
+	std::bitset<32> cnfg_bitset;
+	synapse_cnfg_formater(synapse_controller.cnfg_reg, cnfg_bitset);
+
+	SynapseController flush_command = synapse_controller;
+	flush_command.ctrl_reg.newcmd = true;
+	flush_command.ctrl_reg.cmd = SynapseControllerCmd::WRITE;
+	flush_command.ctrl_reg.row = s.toSynapseRowOnArray();
+
+	for (size_t colset = SynapseSel::min; colset != SynapseSel::end; ++colset) {
+		for (size_t i = 0; i < 4; i++) // single chunks in the columnset
+			writes.emplace_back(
+			    facets::SynapseControl::sc_synin + i, hwdata[8 * i + colset].to_ulong());
+		flush_command.ctrl_reg.sel = SynapseSel(colset);
+		append_syn_ctrl_and_guard(writes, s.toSynapseArrayOnHICANN(), flush_command, cnfg_bitset);
+	}
+}
+
+void append_decoder_double_row_writes(
+    synapse_controller_writes_t& writes,
+    SynapseController const& synapse_controller,
+    SynapseDriverOnHICANN const& s,
+    HMF::HICANN::DecoderDoubleRow const& data)
+{
+	typed_array<SynapseRowOnHICANN, RowOnSynapseDriver> rows;
+	typed_array<std::array<std::bitset<32>, 32>, RowOnSynapseDriver> hwdata;
+	format_decoder_double_row(s, data, rows, hwdata);
+
+	std::bitset<32> cnfg_bitset;
+	synapse_cnfg_formater(synapse_controller.cnfg_reg, cnfg_bitset);
+
+	SynapseController flush_command = synapse_controller;
+	flush_command.ctrl_reg.newcmd = true;
+	flush_command.ctrl_reg.cmd = SynapseControllerCmd::WDEC;
+
+	for (auto row : iter_all<RowOnSynapseDriver>()) {
+		flush_command.ctrl_reg.row = rows[row].toSynapseRowOnArray();
+		for (size_t colset = SynapseSel::min; colset != SynapseSel::end; ++colset) {
+			for (size_t i = 0; i < 4; i++) // single chunks in the columnset
+				writes.emplace_back(
+				    facets::SynapseControl::sc_synin + i, hwdata[row][8 * i + colset].to_ulong());
+			flush_command.ctrl_reg.sel = SynapseSel(colset);
+			append_syn_ctrl_and_guard(
+			    writes, s.toSynapseArrayOnHICANN(), flush_command, cnfg_bitset);
+		}
+	}
+}
+
 void set_decoder_double_row_impl(
     Handle::HICANNHw& h,
     SynapseController const& synapse_controller,
@@ -38,20 +164,14 @@ void set_decoder_double_row_impl(
 
 	ReticleControl& reticle = *h.get_reticle();
 	SynapseControl& sc = reticle.hicann[h.jtag_addr()]->getSC(
-	    s.toSynapseArrayOnHICANN().isTop() ? HicannCtrl::SYNAPSE_TOP : HicannCtrl::SYNAPSE_BOTTOM);
+	    to_synapse_controller(s.toSynapseArrayOnHICANN()));
 
 	typed_array<SynapseRowOnHICANN, RowOnSynapseDriver> rows;
 
 	// save decoder addresses in convenient format for hardware write
 	typed_array<std::array<std::bitset<32>, 32>, RowOnSynapseDriver> hwdata;
 
-	if (s.toSynapseArrayOnHICANN().isTop()) {
-		rows = {SynapseRowOnHICANN(s, RowOnSynapseDriver(top)), SynapseRowOnHICANN(s, RowOnSynapseDriver(bottom))};
-		hwdata = {top_to_decoder(data[top], data[bottom]), bot_to_decoder(data[top], data[bottom])};
-	} else {
-		rows = {SynapseRowOnHICANN(s, RowOnSynapseDriver(bottom)), SynapseRowOnHICANN(s, RowOnSynapseDriver(top))};
-		hwdata = {top_to_decoder(data[bottom], data[top]), bot_to_decoder(data[bottom], data[top])};
-	}
+	format_decoder_double_row(s, data, rows, hwdata);
 
 	// put together a flush command for the controller
 	SynapseController flush_command = synapse_controller;
@@ -89,16 +209,10 @@ void set_weights_row_impl(
 
 	ReticleControl& reticle = *h.get_reticle();
 	SynapseControl& sc = reticle.hicann[h.jtag_addr()]->getSC(
-	    s.toSynapseArrayOnHICANN().isTop() ? HicannCtrl::SYNAPSE_TOP : HicannCtrl::SYNAPSE_BOTTOM);
+	    to_synapse_controller(s.toSynapseArrayOnHICANN()));
 
 	// generate correctly formatted data for the hardware
-	std::array<std::bitset<32>, 32> hwdata;
-
-	for (size_t i = 0; i < 32; i++)
-		hwdata[i] = bit::concat(
-		    weights[8 * i + 0].format(), weights[8 * i + 1].format(), weights[8 * i + 2].format(),
-		    weights[8 * i + 3].format(), weights[8 * i + 4].format(), weights[8 * i + 5].format(),
-		    weights[8 * i + 6].format(), weights[8 * i + 7].format());
+	std::array<std::bitset<32>, 32> const hwdata = format_weights_row(weights);
 
 	// put together a flush command for the controller
 	SynapseController flush_command = synapse_controller;
@@ -120,22 +234,293 @@ void set_weights_row_impl(
 	}
 }
 
+void for_each_reticle(
+    std::vector<boost::shared_ptr<Handle::HICANNHw> > const& handles,
+    std::function<void(std::vector<size_t> const&)> const& f)
+{
+	// group handles by reticle, keeping the order of the handles
+	std::vector<facets::ReticleControl const*> reticles;
+	std::vector<std::vector<size_t> > indices;
+	for (size_t ii = 0; ii < handles.size(); ++ii) {
+		facets::ReticleControl const* const reticle = handles[ii]->get_reticle().get();
+		auto const it = std::find(reticles.begin(), reticles.end(), reticle);
+		if (it == reticles.end()) {
+			reticles.push_back(reticle);
+			indices.push_back({ii});
+		} else {
+			indices[it - reticles.begin()].push_back(ii);
+		}
+	}
+
+	if (indices.size() <= 1) {
+		for (auto const& reticle_indices : indices) {
+			f(reticle_indices);
+		}
+		return;
+	}
+
+	std::vector<std::exception_ptr> errors(indices.size());
+	std::vector<std::thread> threads;
+	threads.reserve(indices.size());
+	for (size_t ii = 0; ii < indices.size(); ++ii) {
+		threads.emplace_back([&f, &indices, &errors, ii]() {
+			try {
+				f(indices[ii]);
+			} catch (...) {
+				errors[ii] = std::current_exception();
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	for (auto const& error : errors) {
+		if (error) {
+			std::rethrow_exception(error);
+		}
+	}
+}
+
+void set_decoder_double_row_impl(
+    std::vector<boost::shared_ptr<Handle::HICANNHw> > const& handles,
+    std::vector<size_t> const& indices,
+    std::vector<SynapseController> const& synapse_controllers,
+    halco::hicann::v2::SynapseDriverOnHICANN const& s,
+    std::vector<HMF::HICANN::DecoderDoubleRow> const& data)
+{
+	using namespace facets;
+
+	SynapseArrayOnHICANN const synarray = s.toSynapseArrayOnHICANN();
+
+	std::vector<SynapseControl*> scs;
+	std::vector<typed_array<std::array<std::bitset<32>, 32>, RowOnSynapseDriver> > hwdata(indices.size());
+	std::vector<SynapseController> flush_commands;
+	typed_array<SynapseRowOnHICANN, RowOnSynapseDriver> rows;
+	for (size_t ii = 0; ii < indices.size(); ++ii) {
+		Handle::HICANNHw& h = *handles[indices[ii]];
+		scs.push_back(&h.get_reticle()->hicann[h.jtag_addr()]->getSC(to_synapse_controller(synarray)));
+		format_decoder_double_row(s, data[indices[ii]], rows, hwdata[ii]);
+
+		// put together a flush command for the controller
+		flush_commands.push_back(synapse_controllers[indices[ii]]);
+		flush_commands.back().ctrl_reg.newcmd = true;
+		flush_commands.back().ctrl_reg.cmd = SynapseControllerCmd::WDEC;
+	}
+
+	// write the data to hardware
+	for (auto row : iter_all<RowOnSynapseDriver>()) {
+		for (size_t colset = SynapseSel::min; colset != SynapseSel::end; ++colset) { // loop over columnsets
+			// issue the commands on all HICANNs...
+			for (size_t ii = 0; ii < indices.size(); ++ii) {
+				for (size_t i = 0; i < 4; i++) { // loop over single chunks in the columnset
+					scs[ii]->write_data(
+					    static_cast<unsigned int>(facets::SynapseControl::sc_synin + i),
+					    static_cast<unsigned int>(hwdata[ii][row][8 * i + colset].to_ulong()));
+				}
+				flush_commands[ii].ctrl_reg.row = rows[row].toSynapseRowOnArray();
+				flush_commands[ii].ctrl_reg.sel = SynapseSel(colset);
+				write_syn_ctrl(*handles[indices[ii]], synarray, flush_commands[ii].ctrl_reg);
+			}
+			// ...before guarding them
+			for (size_t ii = 0; ii < indices.size(); ++ii) {
+				wait_by_dummy(
+				    *handles[indices[ii]], synarray, flush_commands[ii].cnfg_reg,
+				    flush_commands[ii].cycles_synarray(flush_commands[ii].ctrl_reg.cmd));
+			}
+		}
+	}
+}
+
+void set_weights_row_impl(
+    std::vector<boost::shared_ptr<Handle::HICANNHw> > const& handles,
+    std::vector<size_t> const& indices,
+    std::vector<SynapseController> const& synapse_controllers,
+    halco::hicann::v2::SynapseRowOnHICANN const& s,
+    std::vector<HMF::HICANN::WeightRow> const& weights)
+{
+	using namespace facets;
+
+	SynapseArrayOnHICANN const synarray = s.toSynapseArrayOnHICANN();
+
+	std::vector<SynapseControl*> scs;
+	std::vector<std::array<std::bitset<32>, 32> > hwdata;
+	std::vector<SynapseController> flush_commands;
+	for (size_t const index : indices) {
+		Handle::HICANNHw& h = *handles[index];
+		scs.push_back(&h.get_reticle()->hicann[h.jtag_addr()]->getSC(to_synapse_controller(synarray)));
+		hwdata.push_back(format_weights_row(weights[index]));
+
+		// put together a flush command for the controller
+		flush_commands.push_back(synapse_controllers[index]);
+		flush_commands.back().ctrl_reg.newcmd = true;
+		flush_commands.back().ctrl_reg.cmd = SynapseControllerCmd::WRITE;
+		flush_commands.back().ctrl_reg.row = s.toSynapseRowOnArray();
+	}
+
+	// write the data to hardware: columnset-wise
+	for (size_t colset = SynapseSel::min; colset != SynapseSel::end; ++colset) {
+		// issue the commands on all HICANNs...
+		for (size_t ii = 0; ii < indices.size(); ++ii) {
+			for (size_t i = 0; i < 4; i++) // single chunks in the columnset
+				scs[ii]->write_data(
+				    static_cast<unsigned int>(facets::SynapseControl::sc_synin + i),
+				    static_cast<unsigned int>(hwdata[ii][8 * i + colset].to_ulong()));
+			flush_commands[ii].ctrl_reg.sel = SynapseSel(colset);
+			write_syn_ctrl(*handles[indices[ii]], synarray, flush_commands[ii].ctrl_reg);
+		}
+		// ...before guarding them
+		for (size_t ii = 0; ii < indices.size(); ++ii) {
+			wait_by_dummy(
+			    *handles[indices[ii]], synarray, flush_commands[ii].cnfg_reg,
+			    flush_commands[ii].cycles_synarray(flush_commands[ii].ctrl_reg.cmd));
+		}
+	}
+}
+
+facets::HicannCtrl::Synapse to_synapse_controller(SynapseDriverOnHICANN const& s)
+{
+	//upper half of ANNCORE is driven by the top synapse controller
+	return (s.line() < 112) ? facets::HicannCtrl::SYNAPSE_TOP : facets::HicannCtrl::SYNAPSE_BOTTOM;
+}
+
+std::array<std::pair<uint32_t, uint32_t>, 6> synapse_driver_writes(
+    SynapseDriverOnHICANN const& s,
+    SynapseDriver const& driver)
+{
+	//TOP/BOT here refers to hardware coordinates
+	bool TOP = top, BOT = bottom; //init with values where SW coords = HW coords (top half)
+
+	//calculate the correct hardware address of the line
+	uint32_t addr[2];
+
+	if (s.line() < 112){ //upper half of ANNCORE
+		addr[BOT] = 222 - (s.line()*2);
+		addr[TOP] = 222 - (s.line()*2) + 1;
+	}
+	else{ //lower half of ANNCORE, SW coords != HW coords
+		BOT = top;
+		TOP = bottom;
+		addr[BOT] = (s.line() - 112)*2;
+		addr[TOP] = (s.line() - 112)*2 + 1;
+	}
+
+	//convert data to hardware format
+	const std::bitset<8> zeropad = 0;
+	std::array<std::bitset<16>, 2> gmaxfrac;
+	std::array<std::bitset<16>, 2> preouts;
+	std::array<std::bitset<16>, 2> hwconfig;
+
+	typedef std::bitset<4> t4;
+	for (auto const& tt : { top, bottom }) {
+		gmaxfrac[tt] = bit::concat(t4(driver[tt].get_gmax_div(right)),
+								   t4(driver[tt].get_gmax_div(left))).to_ulong();
+	}
+
+	//hardware coords here as the preout values depend on each other and their hardware number
+	typedef std::bitset<2> t2;
+
+	t2 const p0(driver[RowOnSynapseDriver(BOT)].get_decoder(top));
+	t2 const p1(driver[RowOnSynapseDriver(TOP)].get_decoder(top));
+	t2 const p2(driver[RowOnSynapseDriver(BOT)].get_decoder(bottom));
+	t2 const p3(driver[RowOnSynapseDriver(TOP)].get_decoder(bottom));
+
+	preouts = encode_preouts(p0, p1, p2, p3);
+
+	hwconfig[BOT] = bit::concat(zeropad,
+				bit::convert<bool, 1>(driver.stp_enable),
+				bit::convert<bool, 1>(driver.enable),
+				bit::convert<bool, 1>(driver.locin),
+				bit::convert<bool, 1>(driver.connect_neighbor),
+				t2(driver[RowOnSynapseDriver(BOT)].get_gmax()),
+				bit::convert<bool, 1>(driver[RowOnSynapseDriver(BOT)].get_syn_in(right)),
+				bit::convert<bool, 1>(driver[RowOnSynapseDriver(BOT)].get_syn_in(left)));
+
+	hwconfig[TOP] = bit::concat(zeropad,
+				bit::convert<bool, 1>(driver.stp_mode),
+				driver.stp_cap,
+				t2(driver[RowOnSynapseDriver(TOP)].get_gmax()),
+				bit::convert<bool, 1>(driver[RowOnSynapseDriver(TOP)].get_syn_in(right)),
+				bit::convert<bool, 1>(driver[RowOnSynapseDriver(TOP)].get_syn_in(left)));
+
+	//right drivers have registers shifted by 8 bits
+	if (s.toSideHorizontal()==right) {
+		for (size_t i = std::min(TOP, BOT); i <= std::max(TOP, BOT); i++) {
+			gmaxfrac[i] = gmaxfrac[i] << 8;
+			preouts[i] = preouts[i] << 8;
+			hwconfig[i] = hwconfig[i] << 8;
+		}
+	}
+
+	return {{
+		//gmax divisors
+		{facets::SynapseControl::sc_engmax+addr[BOT], gmaxfrac[BOT].to_ulong()},
+		{facets::SynapseControl::sc_engmax+addr[TOP], gmaxfrac[TOP].to_ulong()},
+		//preouts
+		{facets::SynapseControl::sc_endrv+addr[BOT], preouts[bottom].to_ulong()},
+		{facets::SynapseControl::sc_endrv+addr[TOP], preouts[top].to_ulong()},
+		//driver configuration registers
+		{facets::SynapseControl::sc_encfg+addr[BOT], hwconfig[BOT].to_ulong()},
+		{facets::SynapseControl::sc_encfg+addr[TOP], hwconfig[TOP].to_ulong()}
+	}};
+}
+
 void set_syn_ctrl_and_guard(
-    Handle::HICANN& h,
+    Handle::HICANNHw& h,
     halco::hicann::v2::SynapseArrayOnHICANN const& synarray,
     HICANN::SynapseController const& synapse_controller)
 {
-	set_syn_ctrl(h, synarray, synapse_controller.ctrl_reg);
+	write_syn_ctrl(h, synarray, synapse_controller.ctrl_reg);
 	wait_by_dummy(
 	    h, synarray, synapse_controller.cnfg_reg,
 	    synapse_controller.cycles_synarray(synapse_controller.ctrl_reg.cmd));
 }
 
 void wait_by_dummy(
-	Handle::HICANN& h,
+	Handle::HICANNHw& h,
 	halco::hicann::v2::SynapseArrayOnHICANN const& synarray,
 	HICANN::SynapseConfigurationRegister const& cnfg_reg,
 	size_t num_cycles)
+{
+	auto& state = h.synapse_controller_state();
+	SynapseControl& sc = h.get_reticle()->hicann[h.jtag_addr()]->getSC(to_synapse_controller(synarray));
+
+	if (state.poll_status) {
+		// wait for slice_busy and syndrv_busy only (cf. get_syn_status),
+		// auto_busy stays set while the STDP auto-update runs
+		std::bitset<3> const busy_mask(0x3);
+		size_t polls = 1;
+		while ((std::bitset<3>(sc.read_data(facets::SynapseControl::sc_status)) & busy_mask)
+		           .any()) {
+			if (polls == max_synapse_status_polls) {
+				throw std::runtime_error(
+				    "wait_by_dummy: synapse controller still busy after " +
+				    std::to_string(polls) + " status reads");
+			}
+			++polls;
+		}
+		state.polls += polls;
+
+		LOG4CXX_DEBUG(logger, short_format(h.coordinate()) << " " << synarray
+		                      << ": Waited " << num_cycles << " cycles by " << polls
+		                      << " status reads");
+		return;
+	}
+
+	size_t const num_dummys = num_dummy_waits(num_cycles);
+
+	LOG4CXX_DEBUG(logger, short_format(h.coordinate()) << " " << synarray
+	                      <<": Perform " << num_dummys << " dummy waits");
+
+	// format once and write like set_syn_cnfg, but without dispatch
+	std::bitset<32> cnfg_bitset;
+	synapse_cnfg_formater(cnfg_reg, cnfg_bitset);
+	for (size_t i = 0; i < num_dummys; ++i) {
+		sc.write_data(facets::SynapseControl::sc_cnfgreg, cnfg_bitset.to_ulong());
+	}
+	state.dummy_writes += num_dummys;
+}
+
+size_t num_dummy_waits(size_t num_cycles)
 {
 	/*
 	 * At a PLL HICANN frequency of 100 Mhz, the minimum number of HICANN clock cycles
@@ -144,14 +529,7 @@ void wait_by_dummy(
 	 * configured by software is 100 Mhz.
 	 */
 	size_t const min_cycles_per_packet = 2;
-	size_t const num_dummys = std::ceil(num_cycles / (float)min_cycles_per_packet);
-
-	LOG4CXX_DEBUG(logger, short_format(h.coordinate()) << " " << synarray
-	                      <<": Perform " << num_dummys << " dummy waits");
-
-	for (size_t i = 0; i < num_dummys; ++i) {
-		set_syn_cnfg(h, synarray, cnfg_reg);
-	}
+	return std::ceil(num_cycles / (float)min_cycles_per_packet);
 }
 
 /** builds neuron builder configuration byte */
@@ -610,23 +988,81 @@ FGErrorResultRow fg_log_error(
 	return controller_result;
 }
 
+namespace {
+
+// FG controller timings are given in terms of PLL cycles at nominal 100MHz
+std::chrono::nanoseconds fg_pll_cycles(size_t const cycles)
+{
+	return std::chrono::nanoseconds(cycles * 10);
+}
+
+} // namespace
+
+void FGPollSchedule::backoff(std::chrono::steady_clock::time_point const poll_end)
+{
+	next_poll = poll_end + delay;
+	delay = std::min(2 * delay, max_delay);
+}
+
+FGPollSchedule fg_poll_schedule(Handle::HICANNHw& h, FGBlockOnHICANN const& b)
+{
+	using namespace std::chrono;
+	auto const& state = h.fg_controller_state();
+	FGConfig const& config = state.config[b.toEnum()];
+
+	nanoseconds const max_time = fg_pll_cycles(std::max(
+		config.getMaxVoltageProgrammingTime(), config.getMaxCurrentProgrammingTime()));
+	nanoseconds const delay = fg_pll_cycles(config.getMinProgrammingTime());
+	// no write cycle can finish before its first programming cycle
+	return FGPollSchedule{
+		state.issued[b.toEnum()] + delay, delay, std::max(delay, max_time / 32), max_time};
+}
+
+FGPollSchedule fg_poll_schedule(Handle::HICANNHw& h)
+{
+	FGPollSchedule ret = fg_poll_schedule(h, FGBlockOnHICANN(Enum(0)));
+	for (auto const& fgb : iter_all<FGBlockOnHICANN>()) {
+		FGPollSchedule const block = fg_poll_schedule(h, fgb);
+		ret.next_poll = std::max(ret.next_poll, block.next_poll);
+		ret.delay = std::max(ret.delay, block.delay);
+		ret.max_delay = std::max(ret.max_delay, block.max_delay);
+		ret.max_time = std::max(ret.max_time, block.max_time);
+	}
+	return ret;
+}
+
 FGErrorResultRow fg_busy_wait(
 	Handle::HICANNHw & h,
 	FGBlockOnHICANN const& b,
 	int row)
 {
 	using namespace std::chrono;
+	auto& state = h.fg_controller_state();
+	FGPollSchedule schedule = fg_poll_schedule(h, b);
+
+	auto const start = steady_clock::now();
+	// Worst timing for a single row should be about 1.37s
+	auto const end_time = start + std::max<nanoseconds>(seconds(10), 2 * schedule.max_time);
+
 	bool busy;
 	ci_data_t value;
-	// Worst timing for a single row should be about 1.37s
-	auto end_time = system_clock::now() + seconds(10);
 	do {
-		if (system_clock::now() > end_time)
+		if (steady_clock::now() > end_time)
 			throw std::runtime_error("fg_busy_wait timeout on " + short_format(h.coordinate()));
+		std::this_thread::sleep_until(schedule.next_poll);
+
+		auto const poll_start = steady_clock::now();
 		value = fg_read_answer(h, b);
+		auto const poll_end = steady_clock::now();
+		state.polls++;
+		state.poll_time += duration_cast<nanoseconds>(poll_end - poll_start);
 
 		busy = FGErrorResult{value}.get_busy_flag();
+		schedule.backoff(poll_end);
 	} while (busy);
+
+	state.write_cycles++;
+	state.wait_time += duration_cast<nanoseconds>(steady_clock::now() - start);
 	return fg_log_error(h, b, row, value);
 }
 
@@ -638,6 +1074,146 @@ FGErrorResultQuadRow fg_busy_wait(Handle::HICANNHw & h)
 	return result;
 }
 
+bool fg_is_busy(Handle::HICANNHw & h)
+{
+	using namespace std::chrono;
+	auto& state = h.fg_controller_state();
+	for (auto const& fgb : iter_all<FGBlockOnHICANN>()) {
+		// no write cycle can finish before its first programming cycle
+		auto const now = steady_clock::now();
+		if (now < state.issued[fgb.toEnum()] +
+		              fg_pll_cycles(state.config[fgb.toEnum()].getMinProgrammingTime()))
+			return true;
+
+		bool const busy = FGErrorResult{fg_read_answer(h, fgb)}.get_busy_flag();
+		state.polls++;
+		state.poll_time += duration_cast<nanoseconds>(steady_clock::now() - now);
+		if (busy)
+			return true;
+	}
+	return false;
+}
+
+void fg_write_ram(
+	facets::FGControl& fc, FGRow::formatted_row_t const& data, bool const bank)
+{
+	size_t cnt = 0;
+	for (auto const val : data) {
+		// bank 0 is also accessible via the plain data addresses of the controller
+		if (bank)
+			fc.write_ram(bank, cnt++, val);
+		else
+			fc.write_data(cnt++, val);
+	}
+}
+
+FGRamAccess fg_ram_access(
+	Handle::HICANNHw::FGControllerState& state,
+	FGBlockOnHICANN const& b,
+	size_t const row,
+	bool const writeDown,
+	bool const double_buffered)
+{
+	auto const blk = b.toEnum();
+	if (!double_buffered) {
+		state.ram_bank[blk] = false;
+		state.ram_row[blk] = row;
+		return {false, true};
+	}
+	if (!writeDown && state.ram_row[blk] == row)
+		return {state.ram_bank[blk], false};
+
+	state.ram_bank[blk] = !state.ram_bank[blk];
+	state.ram_row[blk] = row;
+	return {state.ram_bank[blk], true};
+}
+
+bool fg_upload_row(
+	Handle::HICANNHw& h,
+	FGBlockOnHICANN const& b,
+	size_t const row,
+	FGRow::formatted_row_t const& data,
+	bool const writeDown,
+	bool const double_buffered)
+{
+	FGRamAccess const access =
+		fg_ram_access(h.fg_controller_state(), b, row, writeDown, double_buffered);
+	if (access.upload)
+		fg_write_ram(h.get_reticle()->hicann[h.jtag_addr()]->getFC(b.toEnum()), data, access.bank);
+	return access.bank;
+}
+
+std::array<bool, 4> fg_upload_row(
+	Handle::HICANNHw& h,
+	FGControl const& fg,
+	size_t const row,
+	bool const writeDown,
+	bool const double_buffered)
+{
+	std::array<bool, 4> banks;
+	for (auto const& b : iter_all<FGBlockOnHICANN>())
+		banks[b.toEnum()] = fg_upload_row(
+			h, b, row, fg.getBlock(b).getFormattedRow(row), writeDown, double_buffered);
+	return banks;
+}
+
+std::array<std::vector<size_t>, 4> fg_dirty_rows(FGControl const& programmed, FGControl const& fg)
+{
+	std::array<std::vector<size_t>, 4> dirty;
+	for (auto const& b : iter_all<FGBlockOnHICANN>()) {
+		FGBlock const& old_block = programmed.getBlock(b);
+		FGBlock const& new_block = fg.getBlock(b);
+		for (size_t row = 0; row < FGBlock::fg_lines; row++) {
+			if (old_block.getFormattedRow(row) != new_block.getFormattedRow(row))
+				dirty[b.toEnum()].push_back(row);
+		}
+	}
+	return dirty;
+}
+
+void fg_write_instruction(
+	Handle::HICANNHw& h, FGBlockOnHICANN const& b, FGInstruction const& instruction)
+{
+	ReticleControl& reticle = *h.get_reticle();
+	reticle.hicann[h.jtag_addr()]->getFC(b.toEnum()).write_data(
+		facets::FGControl::REG_ADDRINS, instruction);
+	auto& state = h.fg_controller_state();
+	state.issued[b.toEnum()] = std::chrono::steady_clock::now();
+	// values differ from the ones known to update_fg_values from now on
+	state.programmed.reset();
+}
+
+void fg_write_instruction(Handle::HICANNHw& h, FGInstruction const& instruction)
+{
+	for (auto const& fgb : iter_all<FGBlockOnHICANN>())
+		fg_write_instruction(h, fgb, instruction);
+}
+
+Handle::HICANNHw::ShadowState* enabled_shadow_state(Handle::HICANNHw::ShadowState& shadow)
+{
+	return shadow.enabled ? &shadow : nullptr;
+}
+
+Handle::HICANNHw::ShadowState* enabled_shadow_state(Handle::HICANNHw& h)
+{
+	return enabled_shadow_state(h.shadow_state());
+}
+
+void set_shadow_mode(Handle::HICANNHw::ShadowState& shadow, ShadowMode const mode)
+{
+	shadow.enabled = mode != ShadowMode::disabled;
+	shadow.serve_reads = mode == ShadowMode::cached_reads;
+	if (!shadow.enabled)
+		shadow.clear();
+}
+
+ShadowMode get_shadow_mode(Handle::HICANNHw::ShadowState const& shadow)
+{
+	if (!shadow.enabled)
+		return ShadowMode::disabled;
+	return shadow.serve_reads ? ShadowMode::cached_reads : ShadowMode::write_through;
+}
+
 
 void set_repeater_direction(
 	HLineOnHICANN const x,
@@ -1,6 +1,13 @@
 #pragma once
 
+#include <array>
+#include <bitset>
+#include <chrono>
 #include <functional>
+#include <utility>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
 
 #include <bitter/integral.h>
 #include <bitter/util.h>
@@ -14,11 +21,13 @@
 
 #include "hal/backend/HICANNBackend.h"
 #include "hal/HICANN/FGErrorResult.h"
+#include "hal/HICANN/FGInstruction.h"
 
 #include "reticle_control.h"
 #include "repeater_control.h"      //repeater control class
 #include "hicann_ctrl.h"           //HICANN control class
 #include "dnc_control.h"
+#include "fg_control.h"
 
 namespace HMF {
 namespace HICANN {
@@ -35,6 +44,85 @@ void set_weights_row_impl(
     halco::hicann::v2::SynapseRowOnHICANN const& s,
     HMF::HICANN::WeightRow const& weights);
 
+/**
+ * Runs f concurrently for the handles of each reticle.
+ *
+ * f is called with the positions (in handles) of all handles located on the
+ * same reticle, in the order of handles.  Reticles are connected via separate
+ * links and are configured in parallel, all accesses to the HICANNs of one
+ * reticle happen in the same thread.
+ *
+ * @throws The first exception thrown by f, after all reticles are done.
+ */
+void for_each_reticle(
+    std::vector<boost::shared_ptr<Handle::HICANNHw> > const& handles,
+    std::function<void(std::vector<size_t> const&)> const& f);
+
+/**
+ * Interleaved variant of set_decoder_double_row_impl for the HICANNs of one reticle.
+ *
+ * The commands of all HICANNs are issued before guarding the commands of the
+ * first HICANN, i.e. the synapse controllers of all HICANNs work concurrently.
+ *
+ * @param indices Positions of the handles (and corresponding data) to configure
+ */
+void set_decoder_double_row_impl(
+    std::vector<boost::shared_ptr<Handle::HICANNHw> > const& handles,
+    std::vector<size_t> const& indices,
+    std::vector<SynapseController> const& synapse_controllers,
+    halco::hicann::v2::SynapseDriverOnHICANN const& s,
+    std::vector<HMF::HICANN::DecoderDoubleRow> const& data);
+
+/**
+ * Interleaved variant of set_weights_row_impl for the HICANNs of one reticle.
+ *
+ * @param indices Positions of the handles (and corresponding data) to configure
+ * @see set_decoder_double_row_impl
+ */
+void set_weights_row_impl(
+    std::vector<boost::shared_ptr<Handle::HICANNHw> > const& handles,
+    std::vector<size_t> const& indices,
+    std::vector<SynapseController> const& synapse_controllers,
+    halco::hicann::v2::SynapseRowOnHICANN const& s,
+    std::vector<HMF::HICANN::WeightRow> const& weights);
+
+/// Synapse controller responsible for the synapse driver
+facets::HicannCtrl::Synapse to_synapse_controller(halco::hicann::v2::SynapseDriverOnHICANN const& s);
+
+/**
+ * Returns the register writes (address, data) to the synapse controller which
+ * configure the synapse driver.  The writes have to be performed in order, each
+ * guarded by a wait for SynapseDriverTimings::cycles_write().
+ */
+std::array<std::pair<uint32_t, uint32_t>, 6> synapse_driver_writes(
+    halco::hicann::v2::SynapseDriverOnHICANN const& s,
+    SynapseDriver const& driver);
+
+/// Register writes (address, data) to a synapse controller, performed in order
+typedef std::vector<std::pair<uint32_t, uint32_t> > synapse_controller_writes_t;
+
+/**
+ * Appends the register writes to the synapse controller which write the weights
+ * of a row, i.e. the SYNIN words and the WRITE command of each column set,
+ * guarded by dummy writes of the configuration register (cf. set_weights_row_impl).
+ */
+void append_weights_row_writes(
+    synapse_controller_writes_t& writes,
+    SynapseController const& synapse_controller,
+    halco::hicann::v2::SynapseRowOnHICANN const& s,
+    HMF::HICANN::WeightRow const& weights);
+
+/**
+ * Appends the register writes to the synapse controller which write the decoders
+ * of a synapse driver's rows (cf. set_decoder_double_row_impl).
+ * @see append_weights_row_writes
+ */
+void append_decoder_double_row_writes(
+    synapse_controller_writes_t& writes,
+    SynapseController const& synapse_controller,
+    halco::hicann::v2::SynapseDriverOnHICANN const& s,
+    HMF::HICANN::DecoderDoubleRow const& data);
+
 /**
  * Sets the synapse controller's control register and
  * guards by sending dummy packets to ensure that the
@@ -45,29 +133,43 @@ void set_weights_row_impl(
  * hardware, else they are changed while setting the control register!
  */
 void set_syn_ctrl_and_guard(
-    Handle::HICANN& h,
+    Handle::HICANNHw& h,
     halco::hicann::v2::SynapseArrayOnHICANN const& synarray,
     HICANN::SynapseController const& synapse_controller);
 
 /**
  * Waits at least the number of cycles specified by num_cycles.
- * The waiting is realized by writing to the configuration register
+ * By default, the waiting is realized by writing to the configuration register
  * of the synapse controller. The number of cycles this writing takes
  * is calculated for a HICANN clock frequency of 100Mhz such that
  * num_cycles is a lower limit for the number of actually waited cycles.
  *
+ * If selected for the handle (cf. HICANN::set_synapse_wait_mode), the status
+ * register of the synapse controller is read instead until neither slice_busy
+ * nor syndrv_busy is set, i.e. the wait is timed by the hardware and
+ * independent of num_cycles.  auto_busy is ignored, hence a running STDP
+ * auto-update does not block the wait.
+ *
  * @param h HICANN Handle.
  * @param synarray Synapse array on HICANN on which synapse controller is located.
  * @param cnfg_reg Content of the synapse configuration register.
  * @param num_cycles Waiting time in number of cycles.
  *
+ * @throws std::runtime_error if the controller is still busy after
+ *         max_synapse_status_polls status reads.
  */
 void wait_by_dummy(
-	Handle::HICANN& h,
+	Handle::HICANNHw& h,
 	halco::hicann::v2::SynapseArrayOnHICANN const& synarray,
 	HICANN::SynapseConfigurationRegister const& cnfg_reg,
 	size_t num_cycles);
 
+/// Number of dummy packets sent by wait_by_dummy to wait num_cycles.
+size_t num_dummy_waits(size_t num_cycles);
+
+/// Upper limit of status reads of a single wait_by_dummy polling the status register.
+size_t const max_synapse_status_polls = 1000;
+
 /** builds neuron builder configuration byte */
 std::bitset<25> nbdata(
 	bool const firet,
@@ -162,6 +264,12 @@ FGErrorResultRow fg_log_error(
 /**
  * Blocks until floating gate block is no longer busy
  *
+ * The controller status is not read continuously: the first read is deferred
+ * to the end of the first programming cycle after the write cycle has been
+ * issued (cf. FGConfig::getMinProgrammingTime), further reads back off
+ * exponentially up to a fraction of the maximum programming time.  Reads and
+ * waiting times are accounted in the FGControllerState of the handle.
+ *
  * @param h HICANN Handle
  * @param b FGBlock coordinate inside HICANN
  *
@@ -183,6 +291,137 @@ FGErrorResultRow fg_busy_wait(
  */
 FGErrorResultQuadRow fg_busy_wait(Handle::HICANNHw & h);
 
+/**
+ * Schedule of the status reads while waiting for a write cycle of the FG controllers.
+ *
+ * The first read is due after the minimal programming time, the delay between
+ * further reads doubles up to a fraction of the maximal programming time.
+ */
+struct FGPollSchedule
+{
+	/// Time of the next status read
+	std::chrono::steady_clock::time_point next_poll;
+	/// Delay after the next status read
+	std::chrono::nanoseconds delay;
+	std::chrono::nanoseconds max_delay;
+	/// Maximal duration of the write cycle as configured
+	std::chrono::nanoseconds max_time;
+
+	/// Schedules the next status read after a read that ended at the given time.
+	void backoff(std::chrono::steady_clock::time_point poll_end);
+};
+
+/// Schedule for the write cycle last issued to the given FG block (cf. fg_write_instruction).
+FGPollSchedule fg_poll_schedule(Handle::HICANNHw& h, halco::hicann::v2::FGBlockOnHICANN const& b);
+
+/// Schedule for the write cycles last issued to all FG blocks, i.e. the slowest block.
+FGPollSchedule fg_poll_schedule(Handle::HICANNHw& h);
+
+/**
+ * Checks without blocking whether any floating gate block is busy
+ *
+ * @param h HICANN Handle
+ */
+bool fg_is_busy(Handle::HICANNHw & h);
+
+
+/// Writes a row of formatted FG values (cf. FGBlock::getFormattedRow) to the given RAM bank of a FG controller.
+void fg_write_ram(
+	facets::FGControl& fc, FGRow::formatted_row_t const& data, bool bank = false);
+
+/// RAM bank of a FG controller to use for a write cycle, cf. fg_ram_access.
+struct FGRamAccess
+{
+	bool bank;
+	/// Whether the values of the row have to be uploaded to that bank
+	bool upload;
+};
+
+/**
+ * Selects the RAM bank of a FG controller for a write cycle of the given row.
+ *
+ * Without double buffering, the values are always uploaded to bank 0.  In
+ * double-buffered mode, they are uploaded to the bank not holding the values
+ * of the last upload, i.e. a write cycle still running from that bank is not
+ * disturbed, whatever the order of the rows.  Writing up a row reuses the
+ * values uploaded for writing it down if they are still present.
+ *
+ * @note The state is updated as if the upload has taken place.
+ */
+FGRamAccess fg_ram_access(
+	Handle::HICANNHw::FGControllerState& state,
+	halco::hicann::v2::FGBlockOnHICANN const& b,
+	size_t row,
+	bool writeDown,
+	bool double_buffered);
+
+/// Uploads the values of a row to the RAM of a FG controller if required (cf.
+/// fg_ram_access), returns the RAM bank to use for the write cycle.
+bool fg_upload_row(
+	Handle::HICANNHw& h,
+	halco::hicann::v2::FGBlockOnHICANN const& b,
+	size_t row,
+	FGRow::formatted_row_t const& data,
+	bool writeDown,
+	bool double_buffered);
+
+/// As above for the given row of all FG blocks, returns the RAM bank per FG block.
+std::array<bool, 4> fg_upload_row(
+	Handle::HICANNHw& h, FGControl const& fg, size_t row, bool writeDown, bool double_buffered);
+
+/**
+ * Rows (per FG block) whose formatted values differ between the given FG
+ * values, i.e. the rows update_fg_values has to program.
+ */
+std::array<std::vector<size_t>, 4> fg_dirty_rows(FGControl const& programmed, FGControl const& fg);
+
+/**
+ * Issues a write cycle instruction (cf. FGInstruction) to the controller of a FG block.
+ *
+ * @note The issue time is recorded to schedule the status reads of fg_busy_wait and the
+ *       values known to update_fg_values are invalidated.
+ */
+void fg_write_instruction(
+	Handle::HICANNHw& h, halco::hicann::v2::FGBlockOnHICANN const& b, FGInstruction const& instruction);
+
+/// Issues the write cycle instruction to the controllers of all FG blocks.
+void fg_write_instruction(Handle::HICANNHw& h, FGInstruction const& instruction);
+
+/// Returns the shadow state if enabled (cf. set_shadow_mode), nullptr otherwise.
+Handle::HICANNHw::ShadowState* enabled_shadow_state(Handle::HICANNHw::ShadowState& shadow);
+
+/// Returns the shadow state of the handle if enabled (cf. set_shadow_mode), nullptr otherwise.
+Handle::HICANNHw::ShadowState* enabled_shadow_state(Handle::HICANNHw& h);
+
+/// Applies a mode to the shadow state, disabling it drops all cached values.
+void set_shadow_mode(Handle::HICANNHw::ShadowState& shadow, ShadowMode mode);
+
+/// Mode of the shadow state as set by set_shadow_mode.
+ShadowMode get_shadow_mode(Handle::HICANNHw::ShadowState const& shadow);
+
+/// Returns the cached value for key if the shadow state serves reads, nullptr otherwise.
+template <typename Map>
+typename Map::mapped_type const* shadow_lookup(
+	Handle::HICANNHw::ShadowState const& shadow,
+	Map Handle::HICANNHw::ShadowState::*map,
+	typename Map::key_type const& key)
+{
+	if (!shadow.enabled || !shadow.serve_reads)
+		return nullptr;
+	auto const& entries = shadow.*map;
+	auto const it = entries.find(key);
+	return it != entries.end() ? &it->second : nullptr;
+}
+
+/// As above for the shadow state of the handle.
+template <typename Map>
+typename Map::mapped_type const* shadow_lookup(
+	Handle::HICANNHw& h,
+	Map Handle::HICANNHw::ShadowState::*map,
+	typename Map::key_type const& key)
+{
+	return shadow_lookup(h.shadow_state(), map, key);
+}
 
 /** builds up an instruction byte to be written to hardware */
 uint32_t fg_instruction(
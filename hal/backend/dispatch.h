@@ -21,6 +21,7 @@
  */
 
 
+#include <algorithm>
 #include <type_traits>
 #include <typeinfo>
 #include <utility>
@@ -46,7 +47,7 @@ struct CopyQualifiers<const T &, U>
 }
 
 template<typename TO_TYPE, typename T>
-auto handles_conversion(T handles)
+auto handles_conversion(T const& handles)
 {
 	/* TODO: Instead of hard-coding support for std::vector we could deduce
 	 * the container type here.
@@ -54,6 +55,7 @@ auto handles_conversion(T handles)
 	static_assert(hate::is_specialization_of<T, std::vector>::value,
 		"only vector-handles are supported for now");
 	std::vector<boost::shared_ptr<TO_TYPE>> ret;
+	ret.reserve(handles.size());
 	for (auto h: handles) {
 		boost::shared_ptr<TO_TYPE> tmp = boost::dynamic_pointer_cast<TO_TYPE>(h);
 		if (tmp) {
@@ -64,6 +66,54 @@ auto handles_conversion(T handles)
 }
 
 
+/* Each dispatcher below used to try a dynamic_cast of the handle, i.e. every
+ * call paid for two failing casts before reaching its backend.  The backend
+ * serving a handle only depends on its dynamic type, which is resolved once
+ * (per thread and handle base type) by handle_kind and cached.
+ */
+enum class HandleKind
+{
+	none,
+	dump,
+	ess,
+	hardware
+};
+
+template <typename HandleType>
+HandleKind handle_kind(HandleType& handle);
+
+/// True if any of the handles (or the single handle) is of the given kind.
+template <typename HandleType>
+bool has_handle_kind(HandleType& handle, HandleKind const kind)
+{
+	if constexpr(! hate::has_iterator<HandleType>::value) {
+		return handle_kind(handle) == kind;
+	} else {
+		return std::any_of(handle.begin(), handle.end(), [kind](auto const& h) {
+			return h && handle_kind(*h) == kind;
+		});
+	}
+}
+
+template <typename To, typename From, typename = void>
+struct is_static_castable : std::false_type {};
+
+template <typename To, typename From>
+struct is_static_castable<To, From,
+	std::void_t<decltype(static_cast<To*>(std::declval<From*>()))> > : std::true_type {};
+
+/// Downcast of a handle known to be of type To (cf. handle_kind), avoids RTTI unless
+/// To derives virtually from From.
+template <typename To, typename From>
+To* handle_cast(From& handle)
+{
+	if constexpr(is_static_castable<To, From>::value) {
+		return static_cast<To*>(&handle);
+	} else {
+		return dynamic_cast<To*>(&handle);
+	}
+}
+
 struct HICANN;
 struct FPGA;
 
@@ -103,11 +153,13 @@ auto do_use_dump(char const* fooname, HandleType& handle, Args... args)
 	 * The HandleToXXX macro generates a struct providing easier translation
 	 * of type names.
 	 */
+	if (!has_handle_kind(handle, HandleKind::dump)) {
+		return;
+	}
 	if constexpr(! hate::has_iterator<HandleType>::value) {
 		typedef typename ::HMF::Handle::HandleToDump<HandleType>::type dumphandle_type;
-		if(auto* h = dynamic_cast<typename std::remove_reference<dumphandle_type>::type*>(&handle)) {
-			h->dump(fooname, *h, args...);
-		}
+		auto* h = handle_cast<typename std::remove_reference<dumphandle_type>::type>(handle);
+		h->dump(fooname, *h, args...);
 	} else {
 		typedef typename ::HMF::Handle::HandleToDump<typename HandleType::value_type::element_type>::type handle_type;
 		auto handles = handles_conversion<handle_type>(handle);
@@ -138,7 +190,8 @@ template<typename T> \
 auto __ess_dispatch_##name(EVERYTWO(T, handle, __VA_ARGS__), typename std::enable_if<!hate::has_iterator<T>::value>::type* = 0) \
 { \
 	typedef typename ::HMF::Handle::HandleToEss<typename std::remove_reference<decltype(handle)>::type>::type __handle_type; \
-	__handle_type* __h = dynamic_cast<typename std::remove_pointer<typename std::remove_reference<__handle_type>>::type::type*>(&handle); \
+	__handle_type* __h = handle_kind(handle) == HandleKind::ess ? \
+		handle_cast<typename std::remove_pointer<typename std::remove_reference<__handle_type>>::type::type>(handle) : nullptr; \
 	typedef decltype(__h->ess(). name (EVERYSECOND(__handle_type, *__h, __VA_ARGS__))) __return_type; \
 	if constexpr(std::is_same<__return_type, void>::value) { \
 		if (__h) { \
@@ -158,8 +211,11 @@ auto __ess_dispatch_##name(EVERYTWO(T, handle, __VA_ARGS__), typename std::enabl
 { \
 	typedef typename decltype(handle) ::value_type __value_type; \
 	typedef typename ::HMF::Handle::HandleToEss<typename __value_type::element_type>::type __handle_type; \
-	auto __handles = handles_conversion<__handle_type>(handle); \
 	auto ret = std::make_pair(false, nullptr); \
+	if (! has_handle_kind(handle, HandleKind::ess)) { \
+		return ret; \
+	} \
+	auto __handles = handles_conversion<__handle_type>(handle); \
 	if (! (__handles.empty() || handle.empty())) { \
 		/* just use one handle (HAL2ESS doesn't really match the hardware backend) to pass the vector */ \
 		__handles[0]->ess(). name (EVERYSECOND(__handle_type, handle, __VA_ARGS__)); \
@@ -206,11 +262,12 @@ auto do_use_hardware(F foo, HandleType& handle, Args... args)
 {
 	if constexpr(! hate::has_iterator<HandleType>::value) {
 		typedef typename ::HMF::Handle::HandleToHw<HandleType>::type handle_type;
-		if(auto * h = dynamic_cast<typename std::remove_reference<handle_type>::type*>(&handle)) {
-			return foo(*h, args...);
+		typedef typename std::remove_reference<handle_type>::type hw_type;
+		if (handle_kind(handle) == HandleKind::hardware) {
+			return foo(*handle_cast<hw_type>(handle), args...);
 		} else {
 			// get rid of "non-void function missing return" warnings...
-			typedef decltype(foo(*h, args...)) return_type;
+			typedef decltype(foo(std::declval<hw_type&>(), args...)) return_type;
 			if constexpr(! std::is_same<return_type, void>::value) {
 				return return_type{};
 			}
@@ -222,6 +279,39 @@ auto do_use_hardware(F foo, HandleType& handle, Args... args)
 	}
 }
 
+template <typename HandleType>
+HandleKind handle_kind(HandleType& handle)
+{
+	// the kind only depends on the dynamic type: cache the last one resolved
+	thread_local std::type_info const* cached_type = nullptr;
+	thread_local HandleKind cached_kind = HandleKind::none;
+
+	std::type_info const* const type = &typeid(handle);
+	if (type == cached_type) {
+		return cached_kind;
+	}
+
+	HandleKind kind = HandleKind::none;
+	if (dynamic_cast<typename std::remove_reference<
+	        typename ::HMF::Handle::HandleToDump<HandleType>::type>::type*>(&handle)) {
+		kind = HandleKind::dump;
+	}
+#ifdef HAVE_ESS
+	else if (dynamic_cast<typename std::remove_reference<
+	             typename ::HMF::Handle::HandleToEss<HandleType>::type>::type*>(&handle)) {
+		kind = HandleKind::ess;
+	}
+#endif
+	else if (dynamic_cast<typename std::remove_reference<
+	             typename ::HMF::Handle::HandleToHw<HandleType>::type>::type*>(&handle)) {
+		kind = HandleKind::hardware;
+	}
+
+	cached_type = type;
+	cached_kind = kind;
+	return kind;
+}
+
 #define USE_HARDWARE(ReturnType, return, name, HandleType, handle, ...) \
 	{ \
 		typedef ::HMF::Handle::HandleToHw<HandleType>::type typehw; \
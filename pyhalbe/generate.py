@@ -72,10 +72,12 @@ def add_print_operator(c):
 containers.extend_std_containers(mb)
 namespaces.include_default_copy_constructors(mb)
 
-for f in ['get_trace']:
-    f = ns_hmf.free_function("get_trace")
+# ADC traces and pulse events are handed over to numpy without copying,
+# read_trace_pulses keeps returning PulseEvents
+for name in ['get_trace', 'read_trace_pulses_numpy']:
+    f = ns_hmf.free_function(name)
     f.call_policies = call_policies.custom_call_policies(
-        "::pywrap::ReturnNumpyPolicy", "pywrap/return_numpy_policy.hpp")
+        "::HMF::pyplusplus::ReturnNumpyViewPolicy", "numpy_view.hpp")
 
 #Normally included classes
 for ns in included_ns:
@@ -107,19 +109,32 @@ for ns in included_ns:
 
 for c in ['Analog', 'BackgroundGenerator', 'BackgroundGeneratorArray',
           'Crossbar', 'CrossbarRow', 'DNCMerger', 'DNCMergerLine',
-          'DecoderDoubleRow', 'DecoderRow', 'DriverDecoder', 'FGBlock',
-          'FGConfig', 'FGControl', 'FGInstruction', 'FGStimulus', 'GbitLink',
+          'DecoderDoubleRow', 'DecoderRow', 'DriverDecoder',
+          'FGConfig', 'FGInstruction', 'FGStimulus', 'GbitLink',
           'HorizontalRepeater', 'L1Address', 'Merger', 'MergerTree', 'Neuron',
           'NeuronConfig', 'NeuronQuad', 'Repeater', 'RepeaterBlock',
           'RowConfig', 'Status', 'STDPEvaluationPattern', 'STDPLUT',
           'SynapseConfigurationRegister', 'SynapseController','SynapseControlRegister',
           'SynapseDecoder', 'SynapseDllresetb', 'SynapseDriver', 'SynapseGen', 'SynapseSel',
           'SynapseStatusRegister', 'SynapseSwitch', 'SynapseSwitchRow', 'SynapseWeight',
-          'TestEvent_3', 'VerticalRepeater', 'WeightRow', 'FGErrorResult',
+          'TestEvent_3', 'VerticalRepeater', 'FGErrorResult',
           'FGErrorResultRow', 'FGErrorResultQuadRow', 'FGRow']:
     cls = ns_hmf.class_('::HMF::HICANN::' + c)
     classes.add_pickle_suite(cls)
 
+def add_raw_pickle_suite(c):
+    """
+    pickling without intermediate string copies, large trivially copyable
+    containers are pickled as plain memory (cf. pickle_suite.hpp)
+    """
+    c.include_files.append('pickle_suite.hpp')
+    c.add_registration_code(
+        'def_pickle(::HMF::pyplusplus::pickle_suite< %s >())' % c.decl_string)
+
+for c in ['::HMF::HICANN::FGBlock', '::HMF::HICANN::FGControl',
+          '::HMF::HICANN::WeightRow', '::HMF::FPGA::PulseEventContainer']:
+    add_raw_pickle_suite(ns_hmf.class_(c))
+
 c = mb.class_('::HMF::ADC::USBSerial')
 c.include()
 classes.add_comparison_operators(c)
@@ -0,0 +1,217 @@
+/*
+ * Zero-copy conversion of returned containers to NumPy arrays
+ *
+ * In contrast to pywrap::ReturnNumpyPolicy, which copies the elements, the
+ * arrays take over the buffer of the returned std::vector.  It is released as
+ * soon as the last array referencing it is garbage-collected.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include <boost/python.hpp>
+
+// all translation units share one NumPy C-API table, cf. import_numpy()
+#define PY_ARRAY_UNIQUE_SYMBOL HMF_pyplusplus_numpy_view_API
+#define NO_IMPORT_ARRAY
+#include <numpy/arrayobject.h>
+#ifndef PyArray_API
+#error "numpy_view.hpp has to be included before any other NumPy header"
+#endif
+
+// defined by the first translation unit using it instead of by NumPy's headers
+inline void** HMF_pyplusplus_numpy_view_API = nullptr;
+
+#include "hal/FPGAContainer.h"
+
+namespace HMF {
+namespace pyplusplus {
+
+namespace bp = boost::python;
+
+/// Loads NumPy's C-API table, like import_array() but shared by all translation units.
+inline void import_numpy()
+{
+	if (HMF_pyplusplus_numpy_view_API)
+		return;
+	bp::object const api = bp::import("numpy.core.multiarray").attr("_ARRAY_API");
+	void* const table = PyCapsule_GetPointer(api.ptr(), nullptr);
+	if (!table)
+		bp::throw_error_already_set();
+	HMF_pyplusplus_numpy_view_API = static_cast<void**>(table);
+	if (PyArray_GetNDArrayCVersion() != NPY_VERSION) {
+		HMF_pyplusplus_numpy_view_API = nullptr;
+		PyErr_SetString(
+		    PyExc_RuntimeError, "numpy_view: module compiled against another NumPy ABI version");
+		bp::throw_error_already_set();
+	}
+}
+
+template <typename T>
+struct numpy_type;
+
+template <> struct numpy_type<uint8_t>  { static int const value = NPY_UINT8; };
+template <> struct numpy_type<uint16_t> { static int const value = NPY_UINT16; };
+template <> struct numpy_type<uint32_t> { static int const value = NPY_UINT32; };
+template <> struct numpy_type<uint64_t> { static int const value = NPY_UINT64; };
+template <> struct numpy_type<float>    { static int const value = NPY_FLOAT32; };
+template <> struct numpy_type<double>   { static int const value = NPY_FLOAT64; };
+
+/// Returns a capsule owning data.
+template <typename T>
+PyObject* make_owner(std::vector<T>* data)
+{
+	PyObject* capsule = PyCapsule_New(data, nullptr, [](PyObject* c) {
+		delete static_cast<std::vector<T>*>(PyCapsule_GetPointer(c, nullptr));
+	});
+	if (!capsule) {
+		delete data;
+		bp::throw_error_already_set();
+	}
+	return capsule;
+}
+
+/// One-dimensional array of descr viewing the buffer of data, which is moved into the array.
+template <typename T>
+PyObject* make_array(std::vector<T>&& data, PyArray_Descr* descr)
+{
+	npy_intp size = data.size();
+	auto* const owned = new std::vector<T>(std::move(data));
+	PyObject* const owner = make_owner(owned);
+
+	PyObject* const array = PyArray_NewFromDescr(
+	    &PyArray_Type, descr, 1, &size, nullptr, owned->data(), NPY_ARRAY_CARRAY, nullptr);
+	if (!array) {
+		Py_DECREF(owner);
+		bp::throw_error_already_set();
+	}
+	// steals the reference to owner, even on failure
+	if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(array), owner) < 0) {
+		Py_DECREF(array);
+		bp::throw_error_already_set();
+	}
+	return array;
+}
+
+template <typename T>
+PyObject* to_numpy(std::vector<T>&& data)
+{
+	import_numpy();
+	return make_array(std::move(data), PyArray_DescrFromType(numpy_type<T>::value));
+}
+
+/// Structured dtype with fields time (uint64) and label (uint16).
+inline PyArray_Descr* pulse_event_dtype(size_t time_offset, size_t label_offset, size_t itemsize)
+{
+	bp::dict fields;
+	fields["names"] = bp::make_tuple("time", "label");
+	fields["formats"] = bp::make_tuple("u8", "u2");
+	fields["offsets"] = bp::make_tuple(time_offset, label_offset);
+	fields["itemsize"] = itemsize;
+
+	PyArray_Descr* descr = nullptr;
+	if (!PyArray_DescrConverter(fields.ptr(), &descr))
+		bp::throw_error_already_set();
+	return descr;
+}
+
+/**
+ * Determines the offsets of time and label within PulseEvent.
+ *
+ * PulseEvent is not standard-layout, hence offsetof can't be used.  Instead,
+ * the members of a probe are located in its object representation.
+ */
+inline bool pulse_event_layout(size_t& time_offset, size_t& label_offset)
+{
+	typedef HMF::FPGA::PulseEvent PulseEvent;
+	PulseEvent::spiketime_t const time = 0x0123456789abcdefull;
+	PulseEvent::label_t const label = 0x2bcd;
+	PulseEvent const probe(HMF::FPGA::PulseAddress(label), time);
+
+	unsigned char bytes[sizeof(PulseEvent)];
+	std::memcpy(bytes, &probe, sizeof(PulseEvent));
+
+	bool found_time = false, found_label = false;
+	for (size_t offset = 0; offset + sizeof(time) <= sizeof(PulseEvent); offset += alignof(PulseEvent::spiketime_t))
+		if (!found_time && !std::memcmp(bytes + offset, &time, sizeof(time))) {
+			time_offset = offset;
+			found_time = true;
+		}
+	for (size_t offset = 0; offset + sizeof(label) <= sizeof(PulseEvent); offset += alignof(PulseEvent::label_t))
+		if (!found_label && !std::memcmp(bytes + offset, &label, sizeof(label))) {
+			label_offset = offset;
+			found_label = true;
+		}
+	return found_time && found_label;
+}
+
+struct PackedPulseEvent
+{
+	uint64_t time;
+	uint16_t label;
+};
+
+/// Structured array with fields time and label, viewing the buffer of events.
+inline PyObject* to_numpy(std::vector<HMF::FPGA::PulseEvent>&& events)
+{
+	import_numpy();
+
+	static size_t time_offset = 0, label_offset = 0;
+	static bool const layout_known = pulse_event_layout(time_offset, label_offset);
+	if (layout_known) {
+		return make_array(
+		    std::move(events),
+		    pulse_event_dtype(time_offset, label_offset, sizeof(HMF::FPGA::PulseEvent)));
+	}
+
+	// exotic layout, needs a single copy (still without Python objects per event)
+	std::vector<PackedPulseEvent> packed;
+	packed.reserve(events.size());
+	for (auto const& event : events)
+		packed.push_back({event.getTime(), event.getLabel()});
+	std::vector<HMF::FPGA::PulseEvent>().swap(events);
+	return make_array(
+	    std::move(packed),
+	    pulse_event_dtype(
+	        offsetof(PackedPulseEvent, time), offsetof(PackedPulseEvent, label),
+	        sizeof(PackedPulseEvent)));
+}
+
+/**
+ * Call policy returning std::vector results as NumPy arrays without copying.
+ *
+ * Arithmetic element types are mapped to the corresponding dtype, pulse
+ * events to a structured dtype with the fields time and label.
+ */
+struct ReturnNumpyViewPolicy : bp::default_call_policies
+{
+	struct result_converter
+	{
+		template <typename T>
+		struct apply
+		{
+			struct type
+			{
+				PyObject* operator()(T const& value) const
+				{
+					// value is the temporary returned by the wrapped function
+					return to_numpy(std::move(const_cast<T&>(value)));
+				}
+
+				PyTypeObject const* get_pytype() const
+				{
+					import_numpy();
+					return &PyArray_Type;
+				}
+			};
+		};
+	};
+};
+
+} // namespace pyplusplus
+} // namespace HMF
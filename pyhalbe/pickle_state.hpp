@@ -0,0 +1,205 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
+
+#include "hal/FPGAContainer.h"
+
+// Encoding of the pickle states of HMF::pyplusplus::pickle_suite, kept free of
+// Python to allow testing it without an interpreter.
+
+namespace HMF {
+namespace pyplusplus {
+
+/**
+ * Raw pickling, i.e. the state is a plain copy of memory instead of a boost
+ * archive.  Enabled for trivially copyable types and vectors of those, further
+ * types can be enabled by specialization.
+ *
+ * @note Like binary archives, raw states can only be unpickled on the same
+ *       architecture.  The size of the copied elements is stored along with
+ *       the state and checked on unpickling.
+ */
+template <typename T, typename Enable = void>
+struct raw_pickle_traits
+{
+	static bool const enabled = false;
+};
+
+template <typename T>
+struct raw_pickle_traits<T, typename std::enable_if<std::is_trivially_copyable<T>::value>::type>
+{
+	static bool const enabled = true;
+	static size_t const element_size = sizeof(T);
+
+	static char const* data(T const& obj) { return reinterpret_cast<char const*>(&obj); }
+	static size_t size(T const&) { return sizeof(T); }
+
+	static void assign(T& obj, char const* data, size_t size)
+	{
+		if (size != sizeof(T))
+			throw std::runtime_error("pickle_suite: state has wrong size");
+		std::memcpy(&obj, data, size);
+	}
+};
+
+template <typename T>
+struct raw_pickle_traits<
+    std::vector<T>, typename std::enable_if<std::is_trivially_copyable<T>::value>::type>
+{
+	static bool const enabled = true;
+	static size_t const element_size = sizeof(T);
+
+	static char const* data(std::vector<T> const& obj)
+	{
+		return reinterpret_cast<char const*>(obj.data());
+	}
+	static size_t size(std::vector<T> const& obj) { return obj.size() * sizeof(T); }
+
+	static void assign(std::vector<T>& obj, char const* data, size_t size)
+	{
+		if (size % sizeof(T))
+			throw std::runtime_error("pickle_suite: state has wrong size");
+		obj.resize(size / sizeof(T));
+		std::memcpy(obj.data(), data, size);
+	}
+};
+
+template <>
+struct raw_pickle_traits<HMF::FPGA::PulseEventContainer>
+{
+	typedef raw_pickle_traits<HMF::FPGA::PulseEventContainer::container_type> events;
+	static bool const enabled = events::enabled;
+	static size_t const element_size = events::element_size;
+
+	static char const* data(HMF::FPGA::PulseEventContainer const& obj)
+	{
+		return events::data(obj.data());
+	}
+	static size_t size(HMF::FPGA::PulseEventContainer const& obj)
+	{
+		return events::size(obj.data());
+	}
+
+	static void assign(HMF::FPGA::PulseEventContainer& obj, char const* data, size_t size)
+	{
+		HMF::FPGA::PulseEventContainer::container_type tmp;
+		events::assign(tmp, data, size);
+		obj = HMF::FPGA::PulseEventContainer(std::move(tmp));
+	}
+};
+
+/**
+ * Prefix of raw states: a magic distinguishing them from boost archives, the
+ * version of the raw format and the size of the copied elements.
+ */
+struct raw_state_header
+{
+	static uint32_t const current_version = 1;
+
+	char magic[8];
+	uint32_t version;
+	uint32_t element_size;
+
+	static raw_state_header make(size_t element_size)
+	{
+		raw_state_header ret;
+		std::memcpy(ret.magic, expected_magic(), sizeof(ret.magic));
+		ret.version = current_version;
+		ret.element_size = static_cast<uint32_t>(element_size);
+		return ret;
+	}
+
+	/// Returns true if the state starts with a raw state header.
+	static bool matches(char const* data, size_t size)
+	{
+		return size >= sizeof(raw_state_header) &&
+		       std::memcmp(data, expected_magic(), sizeof(magic)) == 0;
+	}
+
+private:
+	// boost binary archives start with the length of their signature string,
+	// i.e. never with this magic
+	static char const* expected_magic() { return "HMFraw\0"; }
+};
+
+static_assert(
+    sizeof(raw_state_header) == 16, "raw_state_header has to be stable across builds");
+
+/// Size of the raw state of obj, including its header.
+template <typename T>
+size_t raw_state_size(T const& obj)
+{
+	return sizeof(raw_state_header) + raw_pickle_traits<T>::size(obj);
+}
+
+/// Writes the raw state of obj to out, which has to provide raw_state_size(obj) bytes.
+template <typename T>
+void write_raw_state(T const& obj, char* out)
+{
+	typedef raw_pickle_traits<T> traits;
+	raw_state_header const header = raw_state_header::make(traits::element_size);
+	std::memcpy(out, &header, sizeof(header));
+	std::memcpy(out + sizeof(header), traits::data(obj), traits::size(obj));
+}
+
+namespace detail {
+
+template <typename T>
+void read_archive_state(T& obj, char const* data, size_t size)
+{
+	boost::iostreams::stream<boost::iostreams::array_source> is(data, size);
+	boost::archive::binary_iarchive ia(is);
+	ia >> obj;
+}
+
+template <typename T>
+void read_state(T& obj, char const* data, size_t size, std::true_type /*raw*/)
+{
+	if (!raw_state_header::matches(data, size)) {
+		// written by the former, archive-only pickle suites
+		read_archive_state(obj, data, size);
+		return;
+	}
+
+	raw_state_header header;
+	std::memcpy(&header, data, sizeof(header));
+	if (header.version != raw_state_header::current_version)
+		throw std::runtime_error(
+		    "pickle_suite: unsupported raw state version " + std::to_string(header.version));
+	if (header.element_size != raw_pickle_traits<T>::element_size)
+		throw std::runtime_error(
+		    "pickle_suite: raw state has element size " + std::to_string(header.element_size) +
+		    " instead of " + std::to_string(raw_pickle_traits<T>::element_size));
+	raw_pickle_traits<T>::assign(obj, data + sizeof(header), size - sizeof(header));
+}
+
+template <typename T>
+void read_state(T& obj, char const* data, size_t size, std::false_type /*raw*/)
+{
+	read_archive_state(obj, data, size);
+}
+
+} // namespace detail
+
+/**
+ * Restores obj from a pickle state.  Raw states are recognized by their
+ * header, all other states are read as boost binary archives.
+ * @throws std::runtime_error if a raw state was written by an incompatible
+ *         version or build.
+ */
+template <typename T>
+void read_state(T& obj, char const* data, size_t size)
+{
+	detail::read_state(obj, data, size, std::integral_constant<bool, raw_pickle_traits<T>::enabled>());
+}
+
+} // end namespace pyplusplus
+} // end namespace HMF
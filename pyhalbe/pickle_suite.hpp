@@ -1,36 +1,157 @@
 #pragma once
 
+#include <algorithm>
+#include <cstring>
 #include <string>
-#include <sstream>
+#include <type_traits>
 #include <boost/python.hpp>
 #include <boost/archive/binary_oarchive.hpp>
-#include <boost/archive/binary_iarchive.hpp>
+#include <boost/iostreams/categories.hpp>
+#include <boost/iostreams/stream.hpp>
+
+#include "pickle_state.hpp"
 
 namespace HMF {
 namespace pyplusplus {
 
+namespace detail {
+
+/// Python bytes object grown while writing, avoids copying the state.
+class bytes_buffer
+{
+public:
+	explicit bytes_buffer(size_t capacity) :
+		m_bytes(PyBytes_FromStringAndSize(nullptr, std::max<size_t>(capacity, 1))),
+		m_size(0)
+	{
+		if (!m_bytes)
+			boost::python::throw_error_already_set();
+	}
+
+	~bytes_buffer() { Py_XDECREF(m_bytes); }
+
+	void write(char const* s, size_t n)
+	{
+		size_t const capacity = PyBytes_GET_SIZE(m_bytes);
+		if (m_size + n > capacity)
+			resize(std::max(2 * capacity, m_size + n));
+		std::memcpy(PyBytes_AS_STRING(m_bytes) + m_size, s, n);
+		m_size += n;
+	}
+
+	boost::python::object release()
+	{
+		resize(m_size);
+		boost::python::object ret{boost::python::handle<>(m_bytes)};
+		m_bytes = nullptr;
+		return ret;
+	}
+
+private:
+	bytes_buffer(bytes_buffer const&) = delete;
+
+	void resize(size_t size)
+	{
+		// the bytes object is not shared yet, hence it may be resized in place
+		if (_PyBytes_Resize(&m_bytes, size) < 0)
+			boost::python::throw_error_already_set();
+	}
+
+	PyObject* m_bytes;
+	size_t m_size;
+};
+
+class bytes_sink
+{
+public:
+	typedef char char_type;
+	typedef boost::iostreams::sink_tag category;
+
+	explicit bytes_sink(bytes_buffer& buffer) : m_buffer(&buffer) {}
+
+	std::streamsize write(char const* s, std::streamsize n)
+	{
+		m_buffer->write(s, n);
+		return n;
+	}
+
+private:
+	bytes_buffer* m_buffer;
+};
+
+/// Read-only view of the memory of a Python object supporting the buffer protocol.
+class buffer_view
+{
+public:
+	explicit buffer_view(boost::python::object const& obj)
+	{
+		if (PyObject_GetBuffer(obj.ptr(), &m_view, PyBUF_SIMPLE) < 0)
+			boost::python::throw_error_already_set();
+	}
+
+	~buffer_view() { PyBuffer_Release(&m_view); }
+
+	char const* data() const { return static_cast<char const*>(m_view.buf); }
+	size_t size() const { return m_view.len; }
+
+private:
+	buffer_view(buffer_view const&) = delete;
+
+	Py_buffer m_view;
+};
+
+} // namespace detail
+
+/**
+ * Pickling via boost binary archives or, if raw_pickle_traits are enabled for
+ * T, via a plain copy of memory prefixed by a raw_state_header.
+ *
+ * The state is written directly into a bytes object and read from the memory
+ * of the state, i.e. there are no intermediate string (stream) copies.  States
+ * without header, e.g. str states of former versions, are read as archives.
+ */
 template <typename T>
 struct pickle_suite : boost::python::pickle_suite
 {
 	static boost::python::object
 	getstate(T const& obj)
 	{
-		std::ostringstream os;
-		{
-			boost::archive::binary_oarchive oa(os);
-			oa << obj;
-		}
-		return boost::python::str(os.str());
+		return getstate_impl(obj, std::integral_constant<bool, raw_pickle_traits<T>::enabled>());
 	}
 
 	static void
 	setstate(T & obj, boost::python::object state)
 	{
 		namespace bp = boost::python;
-		std::string st = bp::extract<std::string>(state)();
-		std::istringstream is(st);
-		boost::archive::binary_iarchive ia(is);
-		ia >> obj;
+		if (!PyObject_CheckBuffer(state.ptr())) {
+			// e.g. str states of former versions
+			std::string const st = bp::extract<std::string>(state)();
+			read_state(obj, st.data(), st.size());
+			return;
+		}
+		detail::buffer_view const view(state);
+		read_state(obj, view.data(), view.size());
+	}
+
+private:
+	static boost::python::object getstate_impl(T const& obj, std::true_type /*raw*/)
+	{
+		PyObject* const bytes = PyBytes_FromStringAndSize(nullptr, raw_state_size(obj));
+		if (!bytes)
+			boost::python::throw_error_already_set();
+		write_raw_state(obj, PyBytes_AS_STRING(bytes));
+		return boost::python::object{boost::python::handle<>(bytes)};
+	}
+
+	static boost::python::object getstate_impl(T const& obj, std::false_type /*raw*/)
+	{
+		detail::bytes_buffer buffer(sizeof(T) + 4096);
+		{
+			boost::iostreams::stream<detail::bytes_sink> os{detail::bytes_sink(buffer)};
+			boost::archive::binary_oarchive oa(os);
+			oa << obj;
+		}
+		return buffer.release();
 	}
 };
 
@@ -207,6 +207,53 @@ class Test_PyhalbeBindings(PyhalbeTest):
             loaded = pickle.loads(pickle.dumps(v))
             self.assertIs(loaded, v)
 
+    def test_raw_pickling(self):
+        from pyhalbe import HICANN, FPGA
+        import pyhalco_hicann_v2 as Coordinate
+        from pyhalco_common import Enum
+        import pickle
+
+        fgc = HICANN.FGControl()
+        fgc.setNeuron(Coordinate.NeuronOnHICANN(Enum(42)),
+                      HICANN.neuron_parameter.E_l, 400)
+        state = fgc.__getstate__()
+        self.assertIsInstance(state, bytes)
+        # raw states are prefixed to tell them apart from archives
+        self.assertTrue(state.startswith(b'HMFraw\x00\x00'))
+        self.assertEqual(fgc, pickle.loads(pickle.dumps(fgc)))
+
+        pulses = FPGA.PulseEventContainer([
+            FPGA.PulseEvent(FPGA.PulseAddress(label), time)
+            for label, time in [(1, 200), (2, 100), (3, 300)]])
+        loaded = pickle.loads(pickle.dumps(pulses))
+        self.assertEqual(pulses, loaded)
+        self.assertEqual(3, loaded.size())
+
+    def test_read_trace_pulses_numpy_dtype(self):
+        from pyhalbe import FPGA, Handle
+        import pyhalco_hicann_v2 as Coordinate
+        from pyhalco_common import Enum
+        import numpy as np
+
+        fpga = Handle.FPGADump(Handle.Dump(), Coordinate.FPGAGlobal(Enum(0)))
+        pulses = FPGA.read_trace_pulses_numpy(fpga, 1000)
+
+        self.assertIsInstance(pulses, np.ndarray)
+        self.assertEqual(0, len(pulses))
+        self.assertEqual(('time', 'label'), pulses.dtype.names)
+
+        time_dtype, time_offset = pulses.dtype.fields['time'][:2]
+        label_dtype, label_offset = pulses.dtype.fields['label'][:2]
+        self.assertEqual(np.dtype('u8'), time_dtype)
+        self.assertEqual(np.dtype('u2'), label_dtype)
+        # the fields lie within a PulseEvent and do not overlap
+        itemsize = pulses.dtype.itemsize
+        self.assertLessEqual(time_offset + 8, itemsize)
+        self.assertLessEqual(label_offset + 2, itemsize)
+        self.assertTrue(time_offset + 8 <= label_offset or
+                        label_offset + 2 <= time_offset)
+        self.assertEqual(0, time_offset % 8)
+
     @parametrize(['shared_parameter', 'neuron_parameter'])
     def test_parameter_to_string(self, param):
         from pyhalbe import HICANN
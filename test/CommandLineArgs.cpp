@@ -15,6 +15,8 @@ CommandLineArgs::CommandLineArgs() :
 		f(halco::hicann::v2::FPGAGlobal(halco::common::Enum(0))),
 		fpga_ip(),
 		pmu_ip(),
+		second_f(halco::hicann::v2::FPGAGlobal(halco::common::Enum(0))),
+		second_fpga_ip(),
 		highspeed(true),
 		arq(true),
 		jtag_freq(halco::hicann::v2::JTAGFrequency())
@@ -24,8 +26,8 @@ CommandLineArgs CommandLineArgs::parse(int argc, char *argv[])
 {
 	CommandLineArgs conn;
 
-	std::string fpga_ip, pmu_ip, on;
-	halco::common::Enum h, d, f, w;
+	std::string fpga_ip, pmu_ip, second_fpga_ip, on;
+	halco::common::Enum h, d, f, second_f, w;
 	size_t jtag_freq;
 	std::vector< halco::common::Enum> ah;
 	size_t ll;
@@ -58,6 +60,11 @@ CommandLineArgs CommandLineArgs::parse(int argc, char *argv[])
 		("fpga,f",      po::value<halco::common::Enum>(&f)->default_value(halco::common::Enum(0)),
 			"specify halco::hicann::v2::FPGAOnWafer;\n"
 			"used to determine on-wafer position of the FPGA (which is selected by the IP)")
+		("second_fpga",      po::value<halco::common::Enum>(&second_f)->default_value(halco::common::Enum(0)),
+			"specify halco::hicann::v2::FPGAOnWafer of a second FPGA on the same wafer;\n"
+			"used by tests of multiple reticles")
+		("second_fpga_ip",   po::value<std::string>(&second_fpga_ip)->default_value("0.0.0.0"),
+			 "specify IP (std::string) of the second FPGA, tests of multiple reticles are skipped if unset")
 		("wafer,w",     po::value<halco::common::Enum>(&w)->default_value(halco::common::Enum(0)),
 			"specify Wafer (global enum);\n")
 		("loglevel",    po::value<size_t>(&ll)->default_value(1),
@@ -89,6 +96,9 @@ CommandLineArgs CommandLineArgs::parse(int argc, char *argv[])
 	conn.d = halco::hicann::v2::DNCOnFPGA(d);
 	conn.f = halco::hicann::v2::FPGAGlobal(
 		halco::hicann::v2::FPGAOnWafer(f), halco::hicann::v2::Wafer(w));
+	conn.second_fpga_ip = halco::hicann::v2::IPv4::from_string(second_fpga_ip);
+	conn.second_f = halco::hicann::v2::FPGAGlobal(
+		halco::hicann::v2::FPGAOnWafer(second_f), halco::hicann::v2::Wafer(w));
 	if((on.at(0) == 'w' || on.at(0) == 'W') || (w > 0)) {
 		//on wafer
 		conn.setup = halco::hicann::v2::SetupType::BSSWafer;
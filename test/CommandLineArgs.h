@@ -13,6 +13,9 @@ struct CommandLineArgs
 	halco::hicann::v2::FPGAGlobal   f;
 	halco::hicann::v2::IPv4         fpga_ip;
 	halco::hicann::v2::IPv4         pmu_ip;
+	// optional second FPGA (same DNC), unset if second_fpga_ip is 0.0.0.0
+	halco::hicann::v2::FPGAGlobal   second_f;
+	halco::hicann::v2::IPv4         second_fpga_ip;
 	std::set<halco::hicann::v2::HICANNOnDNC> available_hicanns;
 
 	bool highspeed;
@@ -851,6 +851,59 @@ TYPED_TEST(HICANNBackendTest, FGRealValuesHWTest) { //actual FG values not getta
  * The tests below use HMFBackend to write and low-level functions to read. This way
  * one can distinguish errors that would balance each other out in HMFBackend.
  */
+TYPED_TEST(HICANNBackendTest, ProgramFGValuesHWTest) {
+	std::vector<boost::shared_ptr<Handle::HICANN> > handles;
+	for (auto hicann : g_conn.available_hicanns) {
+		handles.push_back(this->f.get(this->d, hicann));
+		HICANN::init(*handles.back(), false);
+		HICANN::reset_fg_wait_statistics(*handles.back());
+	}
+	std::vector<HICANN::FGControl> const fgs(handles.size());
+
+	auto const results = HICANN::program_fg_values(handles, fgs);
+	ASSERT_EQ(handles.size(), results.size());
+
+	// statistics are only recorded by hardware handles
+	if (!dynamic_cast<Handle::HICANNHw*>(&this->h))
+		return;
+	for (auto const& handle : handles) {
+		auto const statistics = HICANN::get_fg_wait_statistics(*handle);
+		// write down and write up of each row in each FG block
+		EXPECT_EQ(2 * HICANN::FGBlock::fg_lines * FGBlockOnHICANN::size, statistics.write_cycles);
+		// the status reads back off as in fg_busy_wait instead of spinning
+		EXPECT_GT(50, statistics.polls_per_write_cycle());
+	}
+}
+
+TYPED_TEST(HICANNBackendTest, FGDoubleBufferedRowOrderHWTest) {
+	HICANN::init(this->h, false);
+
+	HICANN::FGControl fgc;
+	srand(time(NULL));
+	for (auto blk : iter_all<FGBlockOnHICANN>()) {
+		HICANN::FGBlock& block = fgc.getBlock(blk);
+		for (size_t row = 0; row < HICANN::FGBlock::fg_lines; row++) {
+			block.setSharedRaw(row, rand() % 1024);
+			for (size_t neuron = 0; neuron < 128; neuron++)
+				block.setNeuronRaw(neuron, row, rand() % 1024);
+		}
+	}
+
+	// rows out of order, repeated rows and write up without preceding write down
+	for (size_t const row : {5, 2, 3, 3, 23, 0}) {
+		FGRowOnFGBlock const r(row);
+		if (row != 23)
+			HICANN::set_fg_row_values(this->h, r, fgc, true, false, true);
+		HICANN::set_fg_row_values(this->h, r, fgc, false, false, true);
+		// the RAM last uploaded to holds the values of this row
+		for (auto blk : iter_all<FGBlockOnHICANN>()) {
+			EXPECT_GETTER_EQ(fgc.getBlock(blk).getFGRow(r), HICANN::get_fg_ram_values(this->h, blk))
+				<< row;
+		}
+	}
+	HICANN::wait_fg(this->h);
+}
+
 TYPED_TEST(HICANNBackendTest, WriteSparseMatricesHWTest) {
 	HICANN::init(this->h, false); //initialize HICANN to be able to do the test in the first place
 
@@ -1027,6 +1080,154 @@ TYPED_TEST(HICANNBackendTest, WriteSynapsesHWTest) {
 	//~ RET->getSC(HCSYN::SYNAPSE_BOTTOM).print_decoder();
 }
 
+TYPED_TEST(HICANNBackendTest, WriteSynapseArrayHWTest) {
+	HICANN::init(this->h, false);
+
+	HICANN::SynapseController synapse_controller;
+	HICANN::SynapseWeightMatrix weights;
+	HICANN::SynapseDecoderMatrix decoders;
+	for (auto row : iter_all<SynapseRowOnHICANN>()) {
+		std::generate(weights[row].begin(), weights[row].end(),
+		              IncrementingSequence<HICANN::SynapseWeight>(0xf));
+		std::rotate(weights[row].begin(), weights[row].begin() + row.toEnum().value() % 16, weights[row].end());
+	}
+	for (auto drv : iter_all<SynapseDriverOnHICANN>()) {
+		for (size_t row = 0; row < decoders[drv].size(); ++row) {
+			std::generate(decoders[drv][row].begin(), decoders[drv][row].end(),
+			              IncrementingSequence<HICANN::SynapseDecoder>(0xf));
+			std::rotate(decoders[drv][row].begin(),
+			            decoders[drv][row].begin() + (drv.toEnum().value() + row) % 16,
+			            decoders[drv][row].end());
+		}
+	}
+
+	auto* const hw = dynamic_cast<Handle::HICANNHw*>(&this->h);
+	for (auto const mode :
+	     {HICANN::SynapseWaitMode::dummy_writes, HICANN::SynapseWaitMode::status_polling}) {
+		HICANN::set_synapse_wait_mode(this->h, mode);
+		for (auto synarray : iter_all<SynapseArrayOnHICANN>()) {
+			size_t guards_before = 0;
+			if (hw)
+				guards_before = hw->synapse_controller_state().dummy_writes +
+				                hw->synapse_controller_state().polls;
+
+			HICANN::SynapseArrayUploadStatistics const statistics =
+				HICANN::set_synapse_array(this->h, synapse_controller, synarray, weights, decoders);
+			EXPECT_EQ(224 * 32 + 112 * 64, statistics.data_words);
+			EXPECT_EQ(statistics.data_words / 4, statistics.command_words);
+			EXPECT_EQ(
+			    statistics.data_words + statistics.command_words + statistics.guard_words,
+			    statistics.words);
+
+			// both the streaming and the row-wise path count their guarding packets
+			if (hw) {
+				EXPECT_LT(0, statistics.guard_words);
+				EXPECT_EQ(
+				    guards_before + statistics.guard_words,
+				    hw->synapse_controller_state().dummy_writes +
+				        hw->synapse_controller_state().polls);
+				EXPECT_LT(0., statistics.host_link_words_per_second);
+				std::cout << synarray << ": " << statistics.words_per_second() << " words/s, "
+				          << statistics.host_link_utilization() * 100 << "% of the host link"
+				          << std::endl;
+			} else {
+				EXPECT_EQ(0, statistics.guard_words);
+				EXPECT_EQ(0., statistics.host_link_utilization());
+			}
+		}
+	}
+	HICANN::set_synapse_wait_mode(this->h, HICANN::SynapseWaitMode::dummy_writes);
+
+	for (auto row : {SynapseRowOnHICANN(Enum(0)), SynapseRowOnHICANN(Enum(17)),
+	                 SynapseRowOnHICANN(Enum(300)), SynapseRowOnHICANN(Enum(447))}) {
+		EXPECT_GETTER_EQ(weights[row],
+		                 HICANN::get_weights_row(this->h, synapse_controller, row));
+	}
+	for (auto drv : {SynapseDriverOnHICANN(Enum(0)), SynapseDriverOnHICANN(Enum(113)),
+	                 SynapseDriverOnHICANN(Enum(223))}) {
+		EXPECT_GETTER_EQ(decoders[drv],
+		                 HICANN::get_decoder_double_row(this->h, synapse_controller, drv));
+	}
+}
+
+TYPED_TEST(HICANNBackendTest, SynapseWaitModeHWTest) {
+	HICANN::init(this->h, false);
+
+	HICANN::set_synapse_wait_mode(this->h, HICANN::SynapseWaitMode::status_polling);
+
+	HICANN::SynapseController synapse_controller;
+	HICANN::WeightRow row;
+	std::generate(row.begin(), row.end(), IncrementingSequence<HICANN::SynapseWeight>(0xf));
+	for (auto s : {SynapseRowOnHICANN(Enum(5)), SynapseRowOnHICANN(Enum(400))}) {
+		HICANN::set_weights_row(this->h, synapse_controller, s, row);
+		EXPECT_GETTER_EQ(row, HICANN::get_weights_row(this->h, synapse_controller, s));
+		std::rotate(row.begin(), row.begin() + 1, row.end());
+	}
+
+	HICANN::set_synapse_wait_mode(this->h, HICANN::SynapseWaitMode::dummy_writes);
+	EXPECT_EQ(HICANN::SynapseWaitMode::dummy_writes, HICANN::get_synapse_wait_mode(this->h));
+}
+
+TYPED_TEST(HICANNBackendTest, InterleavedDummyWaitsHWTest) {
+	// dummy writes are only counted by hardware handles
+	if (!dynamic_cast<Handle::HICANNHw*>(&this->h) || g_conn.available_hicanns.size() < 2)
+		return;
+
+	HICANN::SynapseController synapse_controller;
+	std::vector<boost::shared_ptr<Handle::HICANN> > handles;
+	std::vector<HICANN::WeightRow> rows;
+	std::vector<HICANN::DecoderDoubleRow> decoders;
+	for (auto hicann : g_conn.available_hicanns) {
+		handles.push_back(this->f.get(this->d, hicann));
+		HICANN::init(*handles.back(), false);
+		// different data per HICANN, to detect commands applied with the data of another one
+		HICANN::WeightRow row;
+		std::generate(row.begin(), row.end(), IncrementingSequence<HICANN::SynapseWeight>(0xf));
+		std::rotate(row.begin(), row.begin() + handles.size(), row.end());
+		rows.push_back(row);
+		HICANN::DecoderDoubleRow drow;
+		for (auto& decoder_row : drow) {
+			std::generate(
+			    decoder_row.begin(), decoder_row.end(),
+			    IncrementingSequence<HICANN::SynapseDecoder>(0xf));
+			std::rotate(decoder_row.begin(), decoder_row.begin() + handles.size(), decoder_row.end());
+		}
+		std::reverse(drow[1].begin(), drow[1].end());
+		decoders.push_back(drow);
+	}
+	std::vector<HICANN::SynapseController> const synapse_controllers(
+	    handles.size(), synapse_controller);
+
+	auto const dummy_writes = [&handles]() {
+		size_t ret = 0;
+		for (auto const& handle : handles)
+			ret += dynamic_cast<Handle::HICANNHw&>(*handle).synapse_controller_state().dummy_writes;
+		return ret;
+	};
+
+	SynapseRowOnHICANN const s(Enum(5));
+	size_t const before_single = dummy_writes();
+	HICANN::set_weights_row(*handles.front(), synapse_controller, s, rows.front());
+	size_t const single = dummy_writes() - before_single;
+	EXPECT_LT(0, single);
+
+	// each HICANN is guarded by its own dummy writes, which share the in-order
+	// stream with its commands
+	size_t const before = dummy_writes();
+	HICANN::set_weights_row(handles, synapse_controllers, s, rows);
+	EXPECT_EQ(handles.size() * single, dummy_writes() - before);
+
+	SynapseDriverOnHICANN const drv(Enum(7));
+	HICANN::set_decoder_double_row(handles, synapse_controllers, drv, decoders);
+
+	for (size_t ii = 0; ii < handles.size(); ++ii) {
+		EXPECT_EQ(rows[ii], HICANN::get_weights_row(*handles[ii], synapse_controller, s)) << ii;
+		EXPECT_EQ(
+		    decoders[ii], HICANN::get_decoder_double_row(*handles[ii], synapse_controller, drv))
+		    << ii;
+	}
+}
+
 TYPED_TEST(HICANNBackendTest, WriteSynapseDriverHWTest) {
 	HICANN::init(this->h, false); //initialize HICANN to be able to do the test in the first place
 
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 #include "hwtest.h"
 
@@ -292,6 +295,100 @@ TEST_F(Layer2Test, PlaybackTraceTwiceHWTest) {
 	DNC::set_loopback(f, d, DNC::Loopback());
 }
 
-} // namespace HMF
+/// Tests the upload of the playback program in slices with progress reports,
+/// cf. PlaybackTraceSimpleHWTest
+TEST_F(Layer2Test, PlaybackChunkedUploadHWTest) {
+	HICANN::init(h, false);
+
+	HICANN::DNCMergerLine mergers;
+	HICANN::DNCMerger mer;
+	for(int j=0; j<8; j++){
+		if (j%2) mer.config = HICANN::Merger::RIGHT_ONLY;
+		else mer.config = HICANN::Merger::LEFT_ONLY;
+		mer.slow = false;
+		mer.loopback = !(j%2);
+		mergers[halco::hicann::v2::DNCMergerOnHICANN(j)] = mer;
+	}
+	HICANN::set_dnc_merger(h, mergers);
 
+	DNC::GbitReticle gbit = DNC::GbitReticle();
+	HICANN::GbitLink link = HICANN::GbitLink();
+	for (int i = 0; i < 8; i++){
+		if (i%2) link.dirs[i] = HICANN::GbitLink::Direction::TO_DNC;
+		else link.dirs[i] = HICANN::GbitLink::Direction::TO_HICANN;
+	}
+	gbit[hc] = link;
+	HICANN::set_gbit_link(h, link);
+	DNC::set_hicann_directions(f, d, gbit);
+	DNC::set_loopback(f, d, DNC::Loopback() );
 
+	FPGA::PulseEventContainer::container_type pulse_events;
+	size_t isi = 500;
+	size_t num_pulses = 5000;
+	for (size_t np = 0; np<num_pulses; ++np) {
+		FPGA::PulseAddress pulse_address(
+				d,
+				hc,
+				GbitLinkOnHICANN(0),
+				HICANN::Neuron::address_t(np%64));
+		pulse_events.push_back(FPGA::PulseEvent(pulse_address, 1ULL * isi * np + 500 + 126));
+	}
+	FPGA::PulseEventContainer pc(std::move(pulse_events));
+	FPGA::PulseEvent::spiketime_t const runtime_in_dnc_cycles = pc[pc.size()-1].getTime() + 25e3;
+
+	// the whole list at once, for comparison of the throughput
+	auto const start = std::chrono::steady_clock::now();
+	FPGA::write_playback_program(
+	    f, pc, runtime_in_dnc_cycles, /* fpga_hicann_delay */ 63, true /*enable trace recording*/,
+	    false /*drop bg events*/);
+	std::chrono::duration<double> const time = std::chrono::steady_clock::now() - start;
+	std::cout << "write_playback_program: " << pc.size() / time.count() << " pulses/s" << std::endl;
+	FPGA::prime_experiment(f);
+	FPGA::start_experiment(f);
+	FPGA::read_trace_pulses(f, runtime_in_dnc_cycles);
+
+	for (size_t const chunk_size : {size_t(1), size_t(7), size_t(1000), num_pulses + 1}) {
+		std::vector<size_t> uploaded;
+		auto const statistics = FPGA::write_playback_program_chunked(
+		    f, pc, runtime_in_dnc_cycles, /* fpga_hicann_delay */ 63,
+		    true /*enable trace recording*/, false /*drop bg events*/, chunk_size,
+		    [&uploaded, &pc](FPGA::PlaybackUploadStatistics const& s) {
+			    EXPECT_EQ(pc.size(), s.pulses);
+			    uploaded.push_back(s.pulses_uploaded);
+		    });
+		std::cout << "write_playback_program_chunked (chunk size " << chunk_size
+		          << "): " << statistics.pulses_per_second() << " pulses/s" << std::endl;
+
+		EXPECT_EQ(pc.size(), statistics.pulses_uploaded);
+		ASSERT_EQ((num_pulses + chunk_size - 1) / chunk_size, uploaded.size());
+		for (size_t ii = 0; ii < uploaded.size(); ++ii) {
+			EXPECT_EQ(std::min((ii + 1) * chunk_size, num_pulses), uploaded[ii]);
+		}
+
+		FPGA::prime_experiment(f);
+		FPGA::start_experiment(f);
+		FPGA::PulseEventContainer received_data = FPGA::read_trace_pulses(f, runtime_in_dnc_cycles);
+		compare_pulse_lists_address(pc, received_data, /*flip_channel*/ true);
+	}
+
+	// a pulse earlier than fpga_hicann_delay*2
+	FPGA::PulseEventContainer::container_type early_events(pc.data());
+	early_events.back().setTime(2 * 63 - 1);
+	FPGA::PulseEventContainer early(std::move(early_events));
+	std::vector<size_t> uploaded;
+	EXPECT_THROW(
+	    FPGA::write_playback_program_chunked(
+	        f, early, runtime_in_dnc_cycles, /* fpga_hicann_delay */ 63,
+	        true /*enable trace recording*/, false /*drop bg events*/, 7,
+	        [&uploaded](FPGA::PlaybackUploadStatistics const& s) {
+		        uploaded.push_back(s.pulses_uploaded);
+	        }),
+	    std::runtime_error);
+	EXPECT_TRUE(uploaded.empty());
+
+	// leave a consistent playback program behind
+	FPGA::reset(f);
+	DNC::set_loopback(f, d, DNC::Loopback());
+}
+
+} // namespace HMF
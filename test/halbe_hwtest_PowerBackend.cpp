@@ -0,0 +1,101 @@
+#include <array>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "test/hwtest.h"
+#include "hal/Handle/HMFRun.h"
+#include "hal/backend/HICANNBackend.h"
+
+using namespace halco::hicann::v2;
+using namespace halco::common;
+
+namespace HMF {
+
+namespace {
+
+Handle::FPGAHw::HandleParameter handle_parameter(FPGAGlobal const f, IPv4 const fpga_ip)
+{
+	return Handle::FPGAHw::HandleParameter{
+	    f, fpga_ip, g_conn.d, g_conn.available_hicanns, g_conn.available_hicanns,
+	    g_conn.available_hicanns, g_conn.setup, g_conn.pmu_ip, g_conn.jtag_freq};
+}
+
+// creates the handles concurrently, one thread per handle
+template <size_t N>
+std::array<std::unique_ptr<Handle::FPGAHw>, N> create_concurrently(
+    std::array<Handle::FPGAHw::HandleParameter, N> const& parameters)
+{
+	std::array<std::unique_ptr<Handle::FPGAHw>, N> handles;
+	std::array<std::exception_ptr, N> errors;
+	std::vector<std::thread> threads;
+	for (size_t ii = 0; ii < N; ++ii) {
+		threads.emplace_back([ii, &handles, &errors, &parameters]() {
+			try {
+				handles[ii].reset(new Handle::FPGAHw(parameters[ii]));
+			} catch (...) {
+				errors[ii] = std::current_exception();
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	for (auto const& error : errors) {
+		if (error) {
+			std::rethrow_exception(error);
+		}
+	}
+	return handles;
+}
+
+} // namespace
+
+TEST(PowerBackendHWTest, ConcurrentSetupOfOneReticle)
+{
+	auto const parameter = handle_parameter(g_conn.f, g_conn.fpga_ip);
+	std::array<std::unique_ptr<Handle::FPGAHw>, 2> handles;
+	ASSERT_NO_THROW(handles = create_concurrently<2>({{parameter, parameter}}));
+
+	// both handles own the same connection
+	boost::shared_ptr<PowerBackend> const backend = PowerBackend::shared();
+	EXPECT_EQ(1, backend->size());
+	EXPECT_EQ(
+	    &backend->get_reticle(*handles[0], g_conn.d), &backend->get_reticle(*handles[1], g_conn.d));
+
+	// the reticle outlives the first handle
+	handles[0].reset();
+	EXPECT_EQ(1, backend->size());
+	EXPECT_NO_THROW(HICANN::init(*handles[1]->get(g_conn.d, g_conn.h), false));
+
+	handles[1].reset();
+	EXPECT_EQ(0, backend->size());
+}
+
+TEST(PowerBackendHWTest, ConcurrentSetupOfTwoReticles)
+{
+	if (g_conn.second_fpga_ip == IPv4()) {
+		GTEST_SKIP() << "no second FPGA given (--second_fpga, --second_fpga_ip)";
+	}
+
+	std::array<std::unique_ptr<Handle::FPGAHw>, 2> handles;
+	ASSERT_NO_THROW(
+	    handles = create_concurrently<2>({{handle_parameter(g_conn.f, g_conn.fpga_ip),
+	                                       handle_parameter(g_conn.second_f, g_conn.second_fpga_ip)}}));
+
+	boost::shared_ptr<PowerBackend> const backend = PowerBackend::shared();
+	EXPECT_EQ(2, backend->size());
+	EXPECT_NE(
+	    &backend->get_reticle(*handles[0], g_conn.d), &backend->get_reticle(*handles[1], g_conn.d));
+
+	for (auto const& handle : handles) {
+		EXPECT_NO_THROW(HICANN::init(*handle->get(g_conn.d, g_conn.h), false));
+	}
+
+	handles[0].reset();
+	EXPECT_EQ(1, backend->size());
+	EXPECT_NO_THROW(HICANN::init(*handles[1]->get(g_conn.d, g_conn.h), false));
+}
+
+} // namespace HMF
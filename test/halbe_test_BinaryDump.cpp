@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include "halco/hicann/v2/hicann.h"
+#include "hal/Handle/HICANNDump.h"
+#include "hal/Handle/dump/binary_dump.h"
+
+using namespace halco::hicann::v2;
+using namespace halco::common;
+
+namespace HMF {
+namespace Handle {
+
+class BinaryDumpTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		filename = ::testing::TempDir() + "halbe_test_BinaryDump.bin";
+		TearDown();
+	}
+
+	void TearDown() override
+	{
+		std::remove(filename.c_str());
+		std::remove((filename + binary_dump::index_suffix).c_str());
+	}
+
+	void write(bool append)
+	{
+		auto const dumper = boost::make_shared<Dump>();
+		dumper->enableBinaryDump(filename, append);
+		HICANNDump h(dumper, HICANNGlobal(Enum(42)));
+
+		int value = 7;
+		std::vector<int> data{1, 2, 3};
+		h.dump("set_fooIMPL", h, value, data);
+		h.dump("get_barIMPL", h, value);
+	}
+
+	std::string filename;
+};
+
+TEST_F(BinaryDumpTest, RoundTrip)
+{
+	write(false);
+	write(true);
+
+	BinaryDumpReader const reader(filename);
+	ASSERT_EQ(4, reader.size());
+	EXPECT_EQ("set_fooIMPL", reader.name(0));
+	EXPECT_EQ("get_barIMPL", reader.name(1));
+	EXPECT_EQ("set_fooIMPL", reader.name(2));
+
+	HICANNGlobal hicann(Enum(0));
+	int value = 0;
+	std::vector<int> data;
+	reader.load(2, hicann, value, data);
+	EXPECT_EQ(HICANNGlobal(Enum(42)), hicann);
+	EXPECT_EQ(7, value);
+	EXPECT_EQ((std::vector<int>{1, 2, 3}), data);
+}
+
+TEST_F(BinaryDumpTest, ScansWithoutIndex)
+{
+	write(false);
+	std::remove((filename + binary_dump::index_suffix).c_str());
+
+	BinaryDumpReader const reader(filename);
+	ASSERT_EQ(2, reader.size());
+	EXPECT_EQ("get_barIMPL", reader.name(1));
+
+	HICANNGlobal hicann(Enum(0));
+	int value = 0;
+	reader.load(1, hicann, value);
+	EXPECT_EQ(HICANNGlobal(Enum(42)), hicann);
+	EXPECT_EQ(7, value);
+}
+
+} // namespace Handle
+} // namespace HMF
@@ -5,6 +5,7 @@
 #include "hal/HICANN/FGConfig.h"
 #include "hal/HICANN/FGControl.h"
 
+#include "halco/common/iter_all.h"
 #include "halco/hicann/v2/neuron.h"
 
 using namespace halco::hicann::v2;
@@ -306,6 +307,35 @@ TEST(FGBlock, RandomTest)
 	}
 }
 
+TEST(FGBlock, FormattedRowUpToDate)
+{
+	auto const expect_formatted = [](FGBlock const& block) {
+		for (size_t row = 0; row < FGBlock::fg_lines; ++row) {
+			FGRow::formatted_row_t expected{};
+			expected[0] = block.getSharedRaw(row);
+			for (size_t nrn = 0; nrn < 128; ++nrn)
+				expected[(nrn + 1) / 2] |= block.getNeuronRaw(nrn, row) << (nrn % 2 ? 0 : 10);
+			ASSERT_EQ(expected, block.getFormattedRow(row)) << "row " << row;
+		}
+	};
+
+	for (auto b : iter_all<FGBlockOnHICANN>()) {
+		FGBlock block(b);
+		expect_formatted(block);
+
+		for (size_t ii = 0; ii < 100; ++ii) {
+			block.setNeuron(
+				b, NeuronOnFGBlock(rand() % 128), neuron_parameter(rand() % neuron_parameter::__last_neuron),
+				rand() % 1024);
+			block.setShared(b, V_reset, rand() % 1024);
+		}
+		expect_formatted(block);
+
+		FGBlock const copy = block;
+		expect_formatted(copy);
+	}
+}
+
 TEST(FGBlock, Digital)
 {
 	size_t const iterations = 1000;
@@ -356,6 +386,39 @@ TEST(FGBlock, RowConversion)
 	}
 }
 
+TEST(FGBlock, FindParameter)
+{
+	for (auto block : iter_all<FGBlockOnHICANN>())
+	{
+		for (auto row : iter_all<FGRowOnFGBlock>())
+		{
+			auto const nrn = findNeuronParameter(block, row);
+			auto const shrd = findSharedParameter(block, row);
+
+			if (nrn) {
+				EXPECT_EQ(*nrn, getNeuronParameter(block, row));
+				EXPECT_EQ(row, getNeuronRow(block, *nrn));
+			} else {
+				ASSERT_THROW(getNeuronParameter(block, row), std::out_of_range);
+			}
+
+			if (shrd) {
+				EXPECT_EQ(*shrd, getSharedParameter(block, row));
+				EXPECT_EQ(row, getSharedRow(block, *shrd));
+			} else {
+				ASSERT_THROW(getSharedParameter(block, row), std::out_of_range);
+			}
+		}
+
+		for (size_t ii = 0; ii < neuron_parameter::__last_neuron; ++ii) {
+			auto const p = static_cast<neuron_parameter>(ii);
+			auto const found = findNeuronParameter(block, getNeuronRow(block, p));
+			ASSERT_TRUE(static_cast<bool>(found));
+			EXPECT_EQ(p, *found);
+		}
+	}
+}
+
 TEST(FGControl, Defaults)
 {
 	FGControl fgc;
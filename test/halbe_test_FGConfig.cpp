@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include "hal/HICANN/FGConfig.h"
+
+namespace HMF {
+namespace HICANN {
+
+TEST(FGConfig, MinProgrammingTimeOfDefaultConfig)
+{
+	FGConfig const config;
+	// one cycle with the current write time: (write time * pulse length +
+	// read time * pulse length * 129) in slow clock cycles, i.e. 4 PLL cycles each
+	EXPECT_EQ((1 * 10 + 41 * 10 * 129) * 4, config.getMinProgrammingTime());
+}
+
+TEST(FGConfig, MinProgrammingTimeBelowMaxProgrammingTime)
+{
+	for (size_t const maxcycle : {0, 1, 9, 255}) {
+		for (size_t const accelerator : {0, 1, 9, 63}) {
+			for (auto const writetimes : {std::make_pair(15, 1), std::make_pair(1, 15),
+			                              std::make_pair(63, 63), std::make_pair(0, 0)}) {
+				FGConfig config;
+				config.maxcycle = maxcycle;
+				config.acceleratorstep = accelerator;
+				config.voltagewritetime = writetimes.first;
+				config.currentwritetime = writetimes.second;
+
+				size_t const min = config.getMinProgrammingTime();
+				EXPECT_LE(min, config.getMaxVoltageProgrammingTime())
+				    << maxcycle << " " << accelerator << " " << writetimes.first;
+				EXPECT_LE(min, config.getMaxCurrentProgrammingTime())
+				    << maxcycle << " " << accelerator << " " << writetimes.second;
+				EXPECT_LT(0, min);
+			}
+		}
+	}
+}
+
+TEST(FGConfig, MinProgrammingTimeIsSingleCycle)
+{
+	// a single cycle without doubling takes the minimum time
+	FGConfig config;
+	config.maxcycle = 0;
+	config.acceleratorstep = 1;
+	config.voltagewritetime = 20;
+	config.currentwritetime = 3;
+	EXPECT_EQ(config.getMaxCurrentProgrammingTime(), config.getMinProgrammingTime());
+	EXPECT_LT(config.getMinProgrammingTime(), config.getMaxVoltageProgrammingTime());
+}
+
+} // namespace HICANN
+} // namespace HMF
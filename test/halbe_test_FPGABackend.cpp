@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+
+#include "halco/hicann/v2/external.h"
+#include "hal/FPGAContainer.h"
+#include "hal/Handle/Dump.h"
+#include "hal/Handle/FPGADump.h"
+#include "hal/backend/FPGABackend.h"
+
+using namespace halco::hicann::v2;
+using namespace halco::common;
+
+namespace HMF {
+namespace FPGA {
+
+TEST(FPGABackend, ParallelTraceReadoutKeepsOrderAndCapturesErrors)
+{
+	auto const dumper = boost::make_shared<Handle::Dump>();
+	std::vector<boost::shared_ptr<Handle::FPGA> > handles{
+	    boost::make_shared<Handle::FPGADump>(dumper, FPGAGlobal(Enum(3))),
+	    nullptr,
+	    boost::make_shared<Handle::FPGADump>(dumper, FPGAGlobal(Enum(0))),
+	    boost::make_shared<Handle::FPGADump>(dumper, FPGAGlobal(Enum(7)))};
+
+	for (size_t const num_threads : {0, 1, 2}) {
+		auto const results = read_trace_pulses(handles, 1000, num_threads);
+		ASSERT_EQ(handles.size(), results.size());
+
+		EXPECT_EQ(FPGAGlobal(Enum(3)), results[0].fpga);
+		EXPECT_EQ(FPGAGlobal(Enum(0)), results[2].fpga);
+		EXPECT_EQ(FPGAGlobal(Enum(7)), results[3].fpga);
+		for (size_t ii : {0, 2, 3}) {
+			EXPECT_TRUE(results[ii].success()) << ii;
+			EXPECT_TRUE(results[ii].pulse_events.empty()) << ii;
+		}
+
+		// the invalid handle fails on its own
+		ASSERT_FALSE(results[1].success());
+		EXPECT_THROW(std::rethrow_exception(results[1].error), std::invalid_argument);
+	}
+}
+
+TEST(FPGABackend, ChunkedPlaybackUploadReportsOnceForNonHardwareHandles)
+{
+	Handle::FPGADump f(boost::make_shared<Handle::Dump>(), FPGAGlobal(Enum(0)));
+
+	PulseEventContainer::container_type events;
+	for (size_t ii = 0; ii < 10; ++ii) {
+		events.push_back(PulseEvent(PulseAddress(), 1000 + 100 * ii));
+	}
+	PulseEventContainer const pulses(std::move(events));
+
+	EXPECT_THROW(
+	    write_playback_program_chunked(f, pulses, 5000, 63, true, false, 0), std::invalid_argument);
+
+	std::vector<PlaybackUploadStatistics> reports;
+	auto const statistics = write_playback_program_chunked(
+	    f, pulses, 5000, 63, true, false, 3,
+	    [&reports](PlaybackUploadStatistics const& s) { reports.push_back(s); });
+
+	EXPECT_EQ(pulses.size(), statistics.pulses);
+	EXPECT_EQ(pulses.size(), statistics.pulses_uploaded);
+	ASSERT_EQ(1, reports.size());
+	EXPECT_EQ(pulses.size(), reports.front().pulses_uploaded);
+}
+
+} // namespace FPGA
+} // namespace HMF
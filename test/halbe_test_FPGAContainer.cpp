@@ -3,8 +3,13 @@
 #include "halco/hicann/v2/fwd.h"
 #include "halco/common/iter_all.h"
 #include "hal/FPGA/PulseAddress.h"
+#include "hal/FPGAContainer.h"
 
 #include <iostream>
+#include <sstream>
+
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
 
 using namespace halco::hicann::v2;
 using namespace halco::common;
@@ -231,5 +236,112 @@ TEST(PulseAddress, matches)
 	}
 }
 
+TEST(PulseEventColumns, Conversion)
+{
+	PulseEventContainer::container_type const data{
+		PulseEvent(PulseAddress(3), 10), PulseEvent(PulseAddress(1), 20),
+		PulseEvent(PulseAddress(2), 20), PulseEvent(PulseAddress(4), 1ull << 40)};
+	PulseEventContainer const container(data);
+
+	for (bool const delta_encoded : {false, true}) {
+		PulseEventColumns const columns(container, delta_encoded);
+		ASSERT_EQ(data.size(), columns.size());
+		EXPECT_EQ(container, columns.to_container());
+		EXPECT_EQ(data, columns.events());
+		EXPECT_EQ((std::vector<PulseEventColumns::label_t>{3, 1, 2, 4}), columns.labels());
+	}
+
+	// time difference too large for delta encoding
+	EXPECT_FALSE(PulseEventColumns(container, true).delta_encoded());
+	EXPECT_TRUE(PulseEventColumns(PulseEventContainer(
+	    PulseEventContainer::container_type(data.begin(), data.end() - 1)), true).delta_encoded());
+}
+
+TEST(PulseEventColumns, Append)
+{
+	PulseEventColumns columns(true);
+	columns.append(5, 1);
+	columns.append(5, 0);
+	columns.append(7, 2);
+	EXPECT_THROW(columns.append(6, 2), std::invalid_argument);
+	EXPECT_EQ((std::vector<PulseEventColumns::spiketime_t>{5, 5, 7}), columns.times());
+}
+
+TEST(PulseEventColumns, ClearRestoresRequestedEncoding)
+{
+	PulseEventColumns columns(true);
+	columns.append(1, 0);
+	columns.append(1ull << 40, 1);
+	EXPECT_FALSE(columns.delta_encoded());
+
+	columns.clear();
+	EXPECT_TRUE(columns.empty());
+	EXPECT_TRUE(columns.delta_encoded());
+	columns.append(3, 2);
+	columns.append(5, 3);
+	EXPECT_TRUE(columns.delta_encoded());
+	EXPECT_EQ((std::vector<PulseEventColumns::spiketime_t>{3, 5}), columns.times());
+
+	PulseEventColumns absolute;
+	absolute.append(1, 0);
+	absolute.clear();
+	EXPECT_FALSE(absolute.delta_encoded());
+}
+
+TEST(PulseEventColumns, Slice)
+{
+	for (bool const delta_encoded : {false, true}) {
+		PulseEventColumns columns(delta_encoded);
+		for (PulseEventColumns::spiketime_t t = 0; t < 100; t += 10) {
+			columns.append(t, t / 10);
+		}
+		auto const slice = columns.slice(15, 50);
+		EXPECT_EQ((std::vector<PulseEventColumns::spiketime_t>{20, 30, 40}), slice.times());
+		EXPECT_EQ((std::vector<PulseEventColumns::label_t>{2, 3, 4}), slice.labels());
+		EXPECT_TRUE(columns.slice(100, 200).empty());
+		EXPECT_EQ(columns, columns.slice(0, 100));
+	}
+}
+
+TEST(PulseEventColumns, Merge)
+{
+	PulseEventColumns a;
+	a.append(1, 1);
+	a.append(3, 1);
+	a.append(3, 2);
+	PulseEventColumns b(true);
+	b.append(0, 3);
+	b.append(3, 3);
+	b.append(4, 3);
+
+	auto const merged = PulseEventColumns::merge(a, b);
+	EXPECT_FALSE(merged.delta_encoded());
+	EXPECT_EQ((std::vector<PulseEventColumns::spiketime_t>{0, 1, 3, 3, 3, 4}), merged.times());
+	EXPECT_EQ((std::vector<PulseEventColumns::label_t>{3, 1, 1, 2, 3, 3}), merged.labels());
+}
+
+TEST(PulseEventColumns, Serialization)
+{
+	for (bool const delta_encoded : {false, true}) {
+		PulseEventColumns columns(delta_encoded);
+		columns.append(3, 1);
+		columns.append(30, 2);
+
+		std::stringstream stream;
+		{
+			boost::archive::text_oarchive oa{stream};
+			oa << columns;
+		}
+		PulseEventColumns loaded;
+		boost::archive::text_iarchive ia{stream};
+		ia >> loaded;
+		EXPECT_EQ(columns, loaded);
+		EXPECT_EQ(delta_encoded, loaded.delta_encoded());
+
+		// appending continues with the last time
+		EXPECT_THROW(loaded.append(29, 1), std::invalid_argument);
+	}
+}
+
 } // end namespace FPGA
 } // end namespace HMF
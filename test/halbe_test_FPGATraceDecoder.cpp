@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "halco/hicann/v2/external.h"
+#include "hal/backend/FPGATraceDecoder.h"
+
+using namespace halco::hicann::v2;
+using namespace halco::common;
+
+namespace HMF {
+namespace FPGA {
+
+namespace {
+
+std::uint32_t pulse_entry(std::uint32_t label, std::uint32_t timestamp, bool fpga_msb)
+{
+	return timestamp | (label << 15) | (static_cast<std::uint32_t>(fpga_msb) << 29);
+}
+
+std::uint32_t overflow_entry(std::uint32_t count)
+{
+	return (1u << 31) | count;
+}
+
+// the first entry of a 64 bit word is stored in its lower half
+std::uint64_t word(std::uint32_t first, std::uint32_t second)
+{
+	return static_cast<std::uint64_t>(first) | (static_cast<std::uint64_t>(second) << 32);
+}
+
+std::uint32_t const no_event = 1u << 30;
+
+} // namespace
+
+TEST(TraceDecoder, DecodesPulses)
+{
+	TraceDecoder decoder{FPGAGlobal(Enum(0))};
+	std::vector<std::uint64_t> const pdu{
+		word(pulse_entry(1, 100, false), pulse_entry(2, 200, false)),
+		TraceDecoder::end_of_trace_marker};
+
+	TraceDecoder::container_type events;
+	EXPECT_EQ(2, decoder.decode(pdu.data(), pdu.size(), events));
+	EXPECT_TRUE(decoder.received_end_of_trace());
+	ASSERT_EQ(2, events.size());
+	EXPECT_EQ(1, events[0].getLabel());
+	EXPECT_EQ(100, events[0].getTime());
+	EXPECT_EQ(2, events[1].getLabel());
+	EXPECT_EQ(200, events[1].getTime());
+	EXPECT_EQ(2, decoder.pulse_event_count());
+}
+
+TEST(TraceDecoder, ReconstructsTimestampsAcrossPackets)
+{
+	TraceDecoder decoder{FPGAGlobal(Enum(0))};
+	std::uint64_t const max = TraceDecoder::max_timestamp_cnt;
+	TraceDecoder::container_type events;
+
+	std::vector<std::uint64_t> const first{
+		word(pulse_entry(1, 100, false), overflow_entry(1))};
+	EXPECT_EQ(1, decoder.decode(first.data(), first.size(), events));
+	EXPECT_EQ(1, decoder.overflow_count());
+	EXPECT_FALSE(decoder.received_end_of_trace());
+
+	// the overflow count is kept across packets
+	std::vector<std::uint64_t> const second{
+		word(pulse_entry(2, 50, true), pulse_entry(3, 0x7000, false)),
+		TraceDecoder::end_of_trace_marker};
+	EXPECT_EQ(2, decoder.decode(second.data(), second.size(), events));
+
+	ASSERT_EQ(3, events.size());
+	EXPECT_EQ(100, events[0].getTime());
+	EXPECT_EQ(50 + max, events[1].getTime());
+	// registered before, but arrived after the overflow
+	EXPECT_EQ(3, events[2].getLabel());
+	EXPECT_EQ(0x7000, events[2].getTime());
+}
+
+TEST(TraceDecoder, DropsEarlyPulsesAndGarbage)
+{
+	TraceDecoder decoder{FPGAGlobal(Enum(0))};
+	std::vector<std::uint64_t> const pdu{
+		// late pulse without preceding overflow
+		word(pulse_entry(1, 0x4000, false), no_event),
+		// overflow indicator at even index is garbage
+		word(overflow_entry(1), pulse_entry(2, 10, false)),
+		TraceDecoder::end_of_trace_marker};
+
+	TraceDecoder::container_type events;
+	EXPECT_EQ(1, decoder.decode(pdu.data(), pdu.size(), events));
+	EXPECT_EQ(0, decoder.overflow_count());
+	ASSERT_EQ(1, events.size());
+	EXPECT_EQ(2, events[0].getLabel());
+	EXPECT_EQ(10, events[0].getTime());
+}
+
+TEST(TraceDecoder, StopsAtEndOfTrace)
+{
+	TraceDecoder decoder{FPGAGlobal(Enum(0))};
+	std::vector<std::uint64_t> const pdu{
+		TraceDecoder::end_of_trace_marker,
+		word(pulse_entry(1, 100, false), pulse_entry(2, 200, false))};
+
+	TraceDecoder::container_type events;
+	EXPECT_EQ(0, decoder.decode(pdu.data(), pdu.size(), events));
+	EXPECT_TRUE(decoder.received_end_of_trace());
+	EXPECT_TRUE(events.empty());
+
+	EXPECT_EQ(0, decoder.decode(pdu.data() + 1, 1, events));
+	EXPECT_TRUE(events.empty());
+
+	decoder.reset();
+	EXPECT_FALSE(decoder.received_end_of_trace());
+	EXPECT_EQ(2, decoder.decode(pdu.data() + 1, 1, events));
+}
+
+TEST(TraceDecoder, BatchDecoderMatchesEntryDecoder)
+{
+	std::mt19937_64 rng(1234);
+	for (size_t trial = 0; trial < 1000; ++trial) {
+		TraceDecoder entry_decoder{FPGAGlobal(Enum(0))};
+		TraceDecoder batch_decoder{FPGAGlobal(Enum(0))};
+		TraceDecoder::container_type entry_events;
+		TraceDecoder::container_type batch_events;
+
+		size_t const num_packets = 1 + rng() % 5;
+		for (size_t packet = 0; packet < num_packets; ++packet) {
+			std::vector<std::uint64_t> pdu(1 + rng() % 64);
+			for (auto& w : pdu) {
+				// mostly pulse events, some overflow indicators, garbage and markers
+				std::uint32_t first = rng();
+				std::uint32_t second = rng();
+				if (rng() % 4) {
+					first &= 0x3fffffff;
+				}
+				if (rng() % 4) {
+					second &= 0x3fffffff;
+				}
+				w = word(first, second);
+				if (rng() % 128 == 0) {
+					w = TraceDecoder::end_of_trace_marker;
+				}
+			}
+
+			EXPECT_EQ(
+			    entry_decoder.decode_entries(pdu.data(), pdu.size(), entry_events),
+			    batch_decoder.decode_batch(pdu.data(), pdu.size(), batch_events));
+			EXPECT_EQ(entry_decoder.overflow_count(), batch_decoder.overflow_count());
+			EXPECT_EQ(
+			    entry_decoder.received_end_of_trace(), batch_decoder.received_end_of_trace());
+		}
+		ASSERT_EQ(entry_events, batch_events);
+	}
+}
+
+} // namespace FPGA
+} // namespace HMF
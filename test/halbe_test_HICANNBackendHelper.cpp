@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <utility>
+#include <vector>
+
+#include "halco/hicann/v2/fg.h"
+#include "halco/hicann/v2/l1.h"
+#include "halco/hicann/v2/synapse.h"
+#include "hal/backend/HICANNBackendHelper.h"
+
+using namespace halco::hicann::v2;
+using namespace halco::common;
+
+namespace HMF {
+namespace HICANN {
+
+TEST(FGRamAccess, SingleBufferedUsesFirstBank)
+{
+	Handle::HICANNHw::FGControllerState state;
+	FGBlockOnHICANN const b(Enum(1));
+
+	for (size_t const row : {0, 1, 7, 7}) {
+		for (bool const writeDown : {true, false}) {
+			FGRamAccess const access = fg_ram_access(state, b, row, writeDown, false);
+			EXPECT_FALSE(access.bank);
+			EXPECT_TRUE(access.upload);
+		}
+	}
+}
+
+TEST(FGRamAccess, DoubleBufferedTogglesPerUpload)
+{
+	Handle::HICANNHw::FGControllerState state;
+	FGBlockOnHICANN const b(Enum(2));
+
+	// rows in arbitrary order, each written down and up
+	bool previous = state.ram_bank[b.toEnum()];
+	for (size_t const row : {5, 2, 3, 3, 20}) {
+		FGRamAccess const down = fg_ram_access(state, b, row, true, true);
+		EXPECT_TRUE(down.upload) << row;
+		// never upload to the bank a running write cycle may use
+		EXPECT_NE(previous, down.bank) << row;
+
+		FGRamAccess const up = fg_ram_access(state, b, row, false, true);
+		EXPECT_FALSE(up.upload) << row;
+		EXPECT_EQ(down.bank, up.bank) << row;
+		previous = up.bank;
+	}
+
+	// other blocks are not affected
+	EXPECT_FALSE(state.ram_row[0]);
+	EXPECT_FALSE(state.ram_bank[0]);
+}
+
+TEST(FGRamAccess, DoubleBufferedWriteUpOfOtherRowUploads)
+{
+	Handle::HICANNHw::FGControllerState state;
+	FGBlockOnHICANN const b(Enum(0));
+
+	FGRamAccess const down = fg_ram_access(state, b, 4, true, true);
+	// the values of row 6 are not present in either bank
+	FGRamAccess const up = fg_ram_access(state, b, 6, false, true);
+	EXPECT_TRUE(up.upload);
+	EXPECT_NE(down.bank, up.bank);
+	EXPECT_EQ(6, *state.ram_row[b.toEnum()]);
+
+	// after a single-buffered upload, bank 0 holds the values
+	fg_ram_access(state, b, 1, true, false);
+	EXPECT_FALSE(state.ram_bank[b.toEnum()]);
+	FGRamAccess const next = fg_ram_access(state, b, 2, true, true);
+	EXPECT_TRUE(next.bank);
+}
+
+TEST(FGDirtyRows, SelectsChangedRowsPerBlock)
+{
+	FGControl const programmed;
+	FGControl fg = programmed;
+
+	for (auto const& rows : fg_dirty_rows(programmed, fg))
+		EXPECT_TRUE(rows.empty());
+
+	// neuron and shared values change the rows they are located in
+	FGBlock& block1 = fg.getBlock(FGBlockOnHICANN(Enum(1)));
+	block1.setNeuronRaw(5, 20, (block1.getNeuronRaw(5, 20) + 1) % 1024);
+	block1.setNeuronRaw(127, 3, (block1.getNeuronRaw(127, 3) + 1) % 1024);
+	block1.setNeuronRaw(64, 3, (block1.getNeuronRaw(64, 3) + 1) % 1024);
+	FGBlock& block3 = fg.getBlock(FGBlockOnHICANN(Enum(3)));
+	block3.setSharedRaw(0, (block3.getSharedRaw(0) + 1) % 1024);
+
+	auto const dirty = fg_dirty_rows(programmed, fg);
+	EXPECT_TRUE(dirty[0].empty());
+	EXPECT_EQ((std::vector<size_t>{3, 20}), dirty[1]);
+	EXPECT_TRUE(dirty[2].empty());
+	EXPECT_EQ((std::vector<size_t>{0}), dirty[3]);
+
+	// setting a value back to the programmed one leaves its row clean
+	block3.setSharedRaw(0, programmed.getBlock(FGBlockOnHICANN(Enum(3))).getSharedRaw(0));
+	EXPECT_TRUE(fg_dirty_rows(programmed, fg)[3].empty());
+}
+
+TEST(FGPollSchedule, BackoffDoublesDelayUpToMax)
+{
+	using namespace std::chrono;
+	steady_clock::time_point const issued;
+	FGPollSchedule schedule{issued + microseconds(10), microseconds(10), microseconds(70),
+	                        milliseconds(2)};
+
+	std::vector<nanoseconds> delays;
+	steady_clock::time_point poll_end = schedule.next_poll;
+	for (size_t ii = 0; ii < 6; ++ii) {
+		// the read itself takes some time, the delay counts from its end
+		poll_end = schedule.next_poll + microseconds(3);
+		nanoseconds const delay = schedule.delay;
+		schedule.backoff(poll_end);
+		EXPECT_EQ(poll_end + delay, schedule.next_poll) << ii;
+		delays.push_back(delay);
+	}
+
+	EXPECT_EQ(
+	    (std::vector<nanoseconds>{microseconds(10), microseconds(20), microseconds(40),
+	                              microseconds(70), microseconds(70), microseconds(70)}),
+	    delays);
+	EXPECT_EQ(microseconds(70), schedule.delay);
+	EXPECT_EQ(milliseconds(2), schedule.max_time);
+}
+
+TEST(FGPollSchedule, BackoffWithDelayAtMax)
+{
+	using namespace std::chrono;
+	steady_clock::time_point const poll_end = steady_clock::time_point() + seconds(1);
+	FGPollSchedule schedule{poll_end, microseconds(5), microseconds(5), microseconds(5)};
+	schedule.backoff(poll_end);
+	EXPECT_EQ(poll_end + microseconds(5), schedule.next_poll);
+	EXPECT_EQ(microseconds(5), schedule.delay);
+}
+
+TEST(ShadowState, ModeTransitions)
+{
+	Handle::HICANNHw::ShadowState shadow;
+	EXPECT_EQ(ShadowMode::disabled, get_shadow_mode(shadow));
+	EXPECT_EQ(nullptr, enabled_shadow_state(shadow));
+
+	SynapseRowOnHICANN const row(Enum(3));
+	WeightRow weights;
+	weights[7] = SynapseWeight(9);
+
+	set_shadow_mode(shadow, ShadowMode::write_through);
+	EXPECT_EQ(ShadowMode::write_through, get_shadow_mode(shadow));
+	ASSERT_EQ(&shadow, enabled_shadow_state(shadow));
+	enabled_shadow_state(shadow)->weights[row] = weights;
+
+	// switching between enabled modes keeps the cached values
+	set_shadow_mode(shadow, ShadowMode::cached_reads);
+	EXPECT_EQ(ShadowMode::cached_reads, get_shadow_mode(shadow));
+	EXPECT_EQ(1, shadow.weights.size());
+	set_shadow_mode(shadow, ShadowMode::write_through);
+	EXPECT_EQ(1, shadow.weights.size());
+
+	// disabling drops them
+	set_shadow_mode(shadow, ShadowMode::disabled);
+	EXPECT_EQ(ShadowMode::disabled, get_shadow_mode(shadow));
+	EXPECT_EQ(nullptr, enabled_shadow_state(shadow));
+	EXPECT_TRUE(shadow.weights.empty());
+}
+
+TEST(ShadowState, LookupServesOnlyCachedReads)
+{
+	Handle::HICANNHw::ShadowState shadow;
+	std::pair<HLineOnHICANN, Side> const key(HLineOnHICANN(Enum(10)), left);
+	CrossbarRow switches;
+	switches[2] = true;
+
+	set_shadow_mode(shadow, ShadowMode::write_through);
+	enabled_shadow_state(shadow)->crossbar[key] = switches;
+	EXPECT_EQ(nullptr, shadow_lookup(shadow, &Handle::HICANNHw::ShadowState::crossbar, key));
+
+	set_shadow_mode(shadow, ShadowMode::cached_reads);
+	auto const* cached = shadow_lookup(shadow, &Handle::HICANNHw::ShadowState::crossbar, key);
+	ASSERT_NE(nullptr, cached);
+	EXPECT_EQ(switches, *cached);
+
+	// other sides and lines are not cached
+	EXPECT_EQ(nullptr, shadow_lookup(shadow, &Handle::HICANNHw::ShadowState::crossbar,
+	                                 std::pair<HLineOnHICANN, Side>(HLineOnHICANN(Enum(10)), right)));
+	EXPECT_EQ(nullptr, shadow_lookup(shadow, &Handle::HICANNHw::ShadowState::weights,
+	                                 SynapseRowOnHICANN(Enum(0))));
+
+	// clear drops the values but keeps the mode
+	shadow.clear();
+	EXPECT_EQ(ShadowMode::cached_reads, get_shadow_mode(shadow));
+	EXPECT_EQ(nullptr, shadow_lookup(shadow, &Handle::HICANNHw::ShadowState::crossbar, key));
+}
+
+} // namespace HICANN
+} // namespace HMF
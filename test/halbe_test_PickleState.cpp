@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <boost/archive/binary_oarchive.hpp>
+
+#include "halco/hicann/v2/fg.h"
+#include "halco/hicann/v2/neuron.h"
+#include "hal/FPGAContainer.h"
+#include "hal/HICANNContainer.h"
+#include "pyhalbe/pickle_state.hpp"
+
+using namespace halco::hicann::v2;
+using namespace halco::common;
+
+namespace HMF {
+namespace pyplusplus {
+
+namespace {
+
+// state as written by the former pickle suite, i.e. a binary archive
+template <typename T>
+std::string legacy_state(T const& obj)
+{
+	std::ostringstream os;
+	boost::archive::binary_oarchive oa(os);
+	oa << obj;
+	return os.str();
+}
+
+template <typename T>
+std::string raw_state(T const& obj)
+{
+	std::string ret(raw_state_size(obj), '\0');
+	write_raw_state(obj, &ret[0]);
+	return ret;
+}
+
+HICANN::FGControl make_fg_control()
+{
+	HICANN::FGControl fgc;
+	fgc.setNeuron(NeuronOnHICANN(Enum(42)), HICANN::neuron_parameter::E_l, 400);
+	fgc.setNeuron(NeuronOnHICANN(Enum(300)), HICANN::neuron_parameter::V_t, 123);
+	return fgc;
+}
+
+FPGA::PulseEventContainer make_pulses()
+{
+	FPGA::PulseEventContainer::container_type events;
+	for (size_t ii = 0; ii < 10; ++ii) {
+		events.push_back(FPGA::PulseEvent(FPGA::PulseAddress(), 1000 - 10 * ii));
+	}
+	return FPGA::PulseEventContainer(std::move(events));
+}
+
+} // namespace
+
+TEST(PickleState, ReadsLegacyArchiveStates)
+{
+	HICANN::FGControl const fgc = make_fg_control();
+	std::string const fgc_state = legacy_state(fgc);
+	HICANN::FGControl fgc_loaded;
+	read_state(fgc_loaded, fgc_state.data(), fgc_state.size());
+	EXPECT_EQ(fgc, fgc_loaded);
+
+	HICANN::FGBlock const& block = fgc.getBlock(NeuronOnHICANN(Enum(42)).toNeuronFGBlock());
+	std::string const block_state = legacy_state(block);
+	HICANN::FGBlock block_loaded;
+	read_state(block_loaded, block_state.data(), block_state.size());
+	EXPECT_EQ(block, block_loaded);
+
+	HICANN::WeightRow weights;
+	weights[17] = HICANN::SynapseWeight(5);
+	std::string const weights_state = legacy_state(weights);
+	HICANN::WeightRow weights_loaded;
+	read_state(weights_loaded, weights_state.data(), weights_state.size());
+	EXPECT_EQ(weights, weights_loaded);
+
+	FPGA::PulseEventContainer const pulses = make_pulses();
+	std::string const pulses_state = legacy_state(pulses);
+	FPGA::PulseEventContainer pulses_loaded;
+	read_state(pulses_loaded, pulses_state.data(), pulses_state.size());
+	EXPECT_EQ(pulses, pulses_loaded);
+}
+
+TEST(PickleState, RoundTripsRawStates)
+{
+	HICANN::FGControl const fgc = make_fg_control();
+	std::string const fgc_state = raw_state(fgc);
+	ASSERT_TRUE(raw_state_header::matches(fgc_state.data(), fgc_state.size()));
+	HICANN::FGControl fgc_loaded;
+	read_state(fgc_loaded, fgc_state.data(), fgc_state.size());
+	EXPECT_EQ(fgc, fgc_loaded);
+
+	FPGA::PulseEventContainer const pulses = make_pulses();
+	std::string const pulses_state = raw_state(pulses);
+	EXPECT_EQ(sizeof(raw_state_header) + pulses.size() * sizeof(FPGA::PulseEvent),
+	          pulses_state.size());
+	FPGA::PulseEventContainer pulses_loaded;
+	read_state(pulses_loaded, pulses_state.data(), pulses_state.size());
+	EXPECT_EQ(pulses, pulses_loaded);
+
+	// archives are never mistaken for raw states
+	std::string const archive = legacy_state(fgc);
+	EXPECT_FALSE(raw_state_header::matches(archive.data(), archive.size()));
+}
+
+TEST(PickleState, RejectsIncompatibleRawStates)
+{
+	HICANN::WeightRow const weights;
+	std::string state = raw_state(weights);
+	HICANN::WeightRow loaded;
+
+	raw_state_header header;
+	std::memcpy(&header, state.data(), sizeof(header));
+	++header.version;
+	std::memcpy(&state[0], &header, sizeof(header));
+	EXPECT_THROW(read_state(loaded, state.data(), state.size()), std::runtime_error);
+
+	header = raw_state_header::make(sizeof(HICANN::WeightRow) + 1);
+	std::memcpy(&state[0], &header, sizeof(header));
+	EXPECT_THROW(read_state(loaded, state.data(), state.size()), std::runtime_error);
+
+	state = raw_state(weights);
+	state.pop_back();
+	EXPECT_THROW(read_state(loaded, state.data(), state.size()), std::runtime_error);
+}
+
+} // namespace pyplusplus
+} // namespace HMF
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <stdexcept>
+
+#include "halco/common/iter_all.h"
+#include "hal/Handle/HMFRun.h"
+
+using namespace halco::hicann::v2;
+using namespace halco::common;
+
+namespace HMF {
+
+TEST(PowerBackend, LUTEnumeratesJTAGChainPerReticle)
+{
+	std::set<HICANNOnDNC> all;
+	for (auto const h : iter_all<HICANNOnDNC>()) {
+		all.insert(h);
+	}
+	std::set<HICANNOnDNC> const some{HICANNOnDNC(Enum(1)), HICANNOnDNC(Enum(4)),
+	                                 HICANNOnDNC(Enum(6))};
+
+	// LUTs of reticles with different HICANNs are independent
+	PowerBackend::ReticleLUT const full = PowerBackend::make_lut(all, all);
+	PowerBackend::ReticleLUT const partial = PowerBackend::make_lut(some, {HICANNOnDNC(Enum(4))});
+
+	EXPECT_TRUE(full.available.all());
+	EXPECT_TRUE(full.highspeed.all());
+	EXPECT_EQ(some.size(), partial.available.count());
+	EXPECT_EQ(1, partial.highspeed.count());
+	EXPECT_TRUE(partial.highspeed.test(HICANNOnDNC(Enum(4)).toHighspeedLinkOnDNC().toEnum()));
+
+	for (auto const& lut : {full, partial}) {
+		// the JTAG chain contains the available HICANNs in reverse order of their links
+		std::set<uint8_t> addresses;
+		int previous = lut.available.count();
+		for (auto const hs : iter_all<HighspeedLinkOnDNC>()) {
+			HICANNOnDNC const h = hs.toHICANNOnDNC();
+			if (!lut.available.test(hs.toEnum())) {
+				EXPECT_THROW(lut.jtag_addr(h), std::out_of_range);
+				continue;
+			}
+			uint8_t const addr = lut.jtag_addr(h);
+			EXPECT_LT(addr, lut.available.count());
+			EXPECT_LT(addr, previous);
+			previous = addr;
+			addresses.insert(addr);
+		}
+		EXPECT_EQ(lut.available.count(), addresses.size());
+	}
+}
+
+TEST(PowerBackend, LUTOfEmptyReticle)
+{
+	PowerBackend::ReticleLUT const lut = PowerBackend::make_lut({}, {});
+	EXPECT_TRUE(lut.available.none());
+	EXPECT_TRUE(lut.highspeed.none());
+	EXPECT_THROW(lut.jtag_addr(HICANNOnDNC(Enum(0))), std::out_of_range);
+}
+
+} // namespace HMF
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+
+#include "hal/HICANN/SparseConfiguration.h"
+
+using namespace ::HMF::HICANN;
+using namespace halco::hicann::v2;
+using namespace halco::common;
+
+TEST(SparseConfiguration, DiffContainsOnlyChangedEntries)
+{
+	SparseConfiguration previous;
+	previous.weights[SynapseRowOnHICANN(Enum(0))] = WeightRow();
+	previous.weights[SynapseRowOnHICANN(Enum(1))] = WeightRow();
+	previous.crossbar_switches[std::make_pair(HLineOnHICANN(3), left)] = CrossbarRow();
+
+	SparseConfiguration next = previous;
+	ASSERT_TRUE(diff(previous, next).empty());
+
+	WeightRow weights;
+	weights[42] = SynapseWeight(15);
+	next.weights[SynapseRowOnHICANN(Enum(1))] = weights;
+	CrossbarRow switches;
+	switches[1] = true;
+	next.crossbar_switches[std::make_pair(HLineOnHICANN(3), right)] = switches;
+
+	SparseConfiguration const changed = diff(previous, next);
+	ASSERT_EQ(2, changed.rows());
+	ASSERT_EQ(1, changed.weights.count(SynapseRowOnHICANN(Enum(1))));
+	EXPECT_EQ(weights, changed.weights.at(SynapseRowOnHICANN(Enum(1))));
+	EXPECT_EQ(1, changed.crossbar_switches.count(std::make_pair(HLineOnHICANN(3), right)));
+	EXPECT_EQ(
+	    SparseConfiguration::words_per_weights_row + SparseConfiguration::words_per_crossbar_row,
+	    changed.words());
+
+	// entries missing in next are left untouched
+	ASSERT_TRUE(diff(next, previous).weights.count(SynapseRowOnHICANN(Enum(1))));
+	ASSERT_TRUE(diff(next, SparseConfiguration()).empty());
+}
@@ -1,6 +1,8 @@
+#include <algorithm>
 #include <map>
 #include <sstream>
 #include <set>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -171,6 +173,28 @@ TEST(Crossbar, CheckExclusiveness) {
 	EXPECT_FALSE("" == c2.check_exclusiveness(1, 1));
 }
 
+TEST(Crossbar, CheckExclusivenessCounts) {
+	typedef halco::hicann::v2::HLineOnHICANN H;
+	typedef halco::hicann::v2::VLineOnHICANN V;
+
+	Crossbar c;
+	// all switches of column 0 and 255
+	c.set(V(0), H(62), true);
+	c.set(V(0), H(63), true);
+	c.set(V(255), H(62), true);
+	c.set(V(255), H(63), true);
+	EXPECT_FALSE("" == c.check_exclusiveness(2, 1));
+	EXPECT_TRUE("" == c.check_exclusiveness(2, 2));
+	EXPECT_FALSE("" == c.check_exclusiveness(1, 2));
+
+	CrossbarRow row;
+	row[0] = true;
+	c.set_row(H(62), right, row);
+	EXPECT_EQ(row, c.get_row(H(62), right));
+	EXPECT_TRUE(c.get(V(159), H(62)));
+	EXPECT_FALSE(c.get(V(255), H(62)));
+}
+
 TEST(Crossbar, GetLines)
 {
 	using namespace halco::hicann::v2;
@@ -207,6 +231,21 @@ TEST(Crossbar, GetLines)
 	}
 }
 
+TEST(Crossbar, GetLinesMatchesExists)
+{
+	for (size_t yy = 0; yy < Crossbar::y_type::end; ++yy) {
+		Crossbar::y_type const y(yy);
+		std::vector<Crossbar::x_type> expected;
+		for (size_t xx = 0; xx < Crossbar::x_type::end; ++xx) {
+			if (Crossbar::exists(Crossbar::x_type(xx), y))
+				expected.push_back(Crossbar::x_type(xx));
+		}
+		auto const lines = Crossbar::get_lines(y);
+		EXPECT_TRUE(std::equal(expected.begin(), expected.end(), lines.begin(), lines.end()))
+			<< y;
+	}
+}
+
 TEST(Crossbar, StreamOperator)
 {
 	std::ostringstream os;
@@ -546,6 +585,21 @@ TEST(SynapseSwitch, GetLinesFromRows)
 	}
 }
 
+TEST(SynapseSwitch, GetLinesMatchesExists)
+{
+	for (auto row : iter_all<SynapseSwitchRowOnHICANN>()) {
+		std::vector<SynapseSwitch::x_type> expected;
+		for (size_t xx = 0; xx < SynapseSwitch::x_type::end; ++xx) {
+			SynapseSwitch::x_type const x(xx);
+			if (SynapseSwitch::exists(x, row.line()) && x.isLeft() == (row.toSideHorizontal() == left))
+				expected.push_back(x);
+		}
+		auto const lines = SynapseSwitch::get_lines(row);
+		EXPECT_TRUE(std::equal(expected.begin(), expected.end(), lines.begin(), lines.end()))
+			<< row;
+	}
+}
+
 TEST(SynapseSwitch, StreamOperator)
 {
 	std::ostringstream os;
@@ -0,0 +1,85 @@
+#pragma once
+
+// Common harness of the halbe_benchmark_* tools: command line handling and
+// timing of the benchmarked variants.
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include <boost/program_options.hpp>
+
+namespace HMF {
+namespace benchmark {
+
+/// Outcome of a benchmarked variant.
+struct Result
+{
+	/// Number of operations performed
+	size_t operations;
+	/// Checksum over the results of the operations, to compare variants and to keep the
+	/// compiler from discarding the operations
+	size_t checksum;
+};
+
+/**
+ * Runs body repeatedly and prints the number and rate of the operations
+ * performed by its fastest run.
+ *
+ * @param unit Name of the operations in the output, e.g. "calls"
+ * @param repetitions Number of runs, has to be positive
+ * @param body Callable returning a Result
+ * @return The checksum of the result of the last run.
+ */
+template <typename Body>
+size_t run(std::string const& name, std::string const& unit, size_t const repetitions, Body&& body)
+{
+	Result result{0, 0};
+	std::chrono::duration<double> best = std::chrono::duration<double>::max();
+	for (size_t rep = 0; rep < repetitions; ++rep) {
+		auto const start = std::chrono::steady_clock::now();
+		result = body();
+		best = std::min<std::chrono::duration<double> >(
+		    best, std::chrono::steady_clock::now() - start);
+	}
+	std::cout << name << ": " << result.operations << " " << unit << " in "
+	          << best.count() * 1e3 << " ms, " << result.operations / best.count() << " "
+	          << unit << "/s\n";
+	return result.checksum;
+}
+
+/// Runs body once, cf. above.
+template <typename Body>
+size_t run(std::string const& name, std::string const& unit, Body&& body)
+{
+	return run(name, unit, 1, std::forward<Body>(body));
+}
+
+/// Options of a benchmark, including --help.
+inline boost::program_options::options_description options()
+{
+	boost::program_options::options_description desc("Allowed options");
+	desc.add_options()("help", "produce help message");
+	return desc;
+}
+
+/// Parses the command line, returns false if the help has been printed instead.
+inline bool parse_command_line(
+    int argc, char* argv[], boost::program_options::options_description const& desc)
+{
+	namespace po = boost::program_options;
+	po::variables_map vm;
+	po::store(po::parse_command_line(argc, argv, desc), vm);
+	if (vm.count("help")) {
+		std::cout << desc << "\n";
+		return false;
+	}
+	po::notify(vm);
+	return true;
+}
+
+} // namespace benchmark
+} // namespace HMF
@@ -0,0 +1,177 @@
+// Microbenchmark of the backend dispatch overhead.
+//
+// Compares the resolution of the handle kind via a dynamic_cast chain (as
+// done on every call by the former dispatchers) to the cached handle_kind for
+// handles of each kind; the chain tests the hardware kind last.
+//
+// Calls a cheap setter and getter (set_crossbar_switch_row,
+// get_crossbar_switch_row) on a dump handle without enabled archives, i.e.
+// measures the cost of routing a call to its backend.  The calls are also
+// measured on an ESS handle (if built with ESS) and on a hardware handle (if
+// an FPGA is given), where they include the backend's work.
+//
+// Run it on different revisions to compare the calls/s of the public API.
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+#include <boost/program_options.hpp>
+
+#include "halco/hicann/v2/hicann.h"
+#include "halco/hicann/v2/l1.h"
+#include "hal/Handle/Dump.h"
+#include "hal/Handle/FPGAHw.h"
+#include "hal/Handle/HICANNDump.h"
+#include "hal/Handle/HICANNHw.h"
+#ifdef HAVE_ESS
+#include "hal/Handle/Ess.h"
+#include "hal/Handle/FPGAEss.h"
+#include "hal/Handle/HICANNEss.h"
+#endif
+#include "hal/backend/HICANNBackend.h"
+#include "hal/backend/dispatch.h"
+
+#include "halbe_benchmark.h"
+
+namespace po = boost::program_options;
+
+using namespace HMF;
+using namespace halco::hicann::v2;
+using namespace halco::common;
+
+namespace {
+
+template <typename Call>
+size_t run(std::string const& name, size_t const calls, Call&& call)
+{
+	return HMF::benchmark::run(name, "calls", [&]() {
+		HMF::benchmark::Result result{calls, 0};
+		for (size_t ii = 0; ii < calls; ++ii) {
+			result.checksum += call(ii);
+		}
+		return result;
+	});
+}
+
+// resolution of the handle kind as done by the dispatchers before handle_kind
+HandleKind dynamic_cast_chain(Handle::HICANN& handle)
+{
+	if (dynamic_cast<Handle::HICANNDump*>(&handle)) {
+		return HandleKind::dump;
+	}
+#ifdef HAVE_ESS
+	if (dynamic_cast<Handle::HICANNEss*>(&handle)) {
+		return HandleKind::ess;
+	}
+#endif
+	if (dynamic_cast<Handle::HICANNHw*>(&handle)) {
+		return HandleKind::hardware;
+	}
+	return HandleKind::none;
+}
+
+// handle whose calls are measured
+struct Target
+{
+	std::string name;
+	Handle::HICANN* handle;
+	size_t calls;
+};
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	size_t calls, hw_calls;
+	std::string fpga_ip, pmu_ip, on;
+	Enum d, w, hicann;
+
+	po::options_description desc = HMF::benchmark::options();
+	desc.add_options()
+		("calls", po::value<size_t>(&calls)->default_value(10000000),
+			 "number of calls per variant")
+		("fpga_ip", po::value<std::string>(&fpga_ip),
+			 "specify FPGA ip, calls on a hardware handle are measured if given")
+		("pmu_ip", po::value<std::string>(&pmu_ip)->default_value("0.0.0.0"), "specify PMU ip")
+		("on", po::value<std::string>(&on)->default_value("vertical"),
+			 "specify hardware backend [[w]afer,[v]ertical]")
+		("dnc", po::value<Enum>(&d)->default_value(Enum(1)), "specify DNC (FPGA-local enum)")
+		("hicann", po::value<Enum>(&hicann)->default_value(Enum(0)),
+			 "specify HICANN (DNC-local enum)")
+		("wafer", po::value<Enum>(&w)->default_value(Enum(0)), "specify Wafer number")
+		("hw_calls", po::value<size_t>(&hw_calls)->default_value(1000),
+			 "number of calls per variant on the hardware handle")
+		;
+	if (!HMF::benchmark::parse_command_line(argc, argv, desc))
+		return EXIT_SUCCESS;
+
+	// no archive enabled: the dump backend writes nothing
+	Handle::HICANNDump dump_handle(boost::make_shared<Handle::Dump>(), HICANNGlobal(Enum(0)));
+	// only the type matters for the resolution of the kind, no connection needed
+	Handle::HICANNHw unconnected_hw_handle(
+	    HICANNGlobal(Enum(0)), boost::shared_ptr<facets::ReticleControl>(), 0, false);
+
+	std::vector<Target> targets{{"dump", &dump_handle, calls}};
+	std::vector<Target> kinds{{"dump", &dump_handle, calls},
+	                          {"hardware", &unconnected_hw_handle, calls}};
+
+#ifdef HAVE_ESS
+	DNCOnFPGA const ess_dnc(Enum(0));
+	HICANNOnDNC const ess_hicann(Enum(0));
+	Handle::FPGAEss ess_fpga(
+	    FPGAGlobal(), boost::make_shared<Handle::Ess>(),
+	    std::vector<HICANNOnWafer>{ess_hicann.toHICANNOnWafer(ess_dnc.toDNCOnWafer(FPGAGlobal()))});
+	Handle::HICANN& ess_handle = *ess_fpga.get(ess_dnc, ess_hicann);
+	targets.push_back({"ess", &ess_handle, calls});
+	kinds.push_back({"ess", &ess_handle, calls});
+#endif
+
+	std::unique_ptr<Handle::FPGAHw> fpga;
+	if (!fpga_ip.empty()) {
+		bool const on_wafer = (on.at(0) == 'w' || on.at(0) == 'W');
+		fpga.reset(new Handle::FPGAHw(
+		    FPGAGlobal(FPGAOnWafer(), Wafer(w)), IPv4::from_string(fpga_ip), DNCOnFPGA(d),
+		    IPv4::from_string(pmu_ip), on_wafer));
+		Handle::HICANNHw& hw_handle = *fpga->get(DNCOnFPGA(d), HICANNOnDNC(hicann));
+		HICANN::init(hw_handle, false);
+		targets.push_back({"hardware", &hw_handle, hw_calls});
+	}
+
+	for (auto const& kind : kinds) {
+		Handle::HICANN& handle = *kind.handle;
+		auto const chain = run("dynamic_cast chain (" + kind.name + ")", kind.calls,
+		                       [&handle](size_t) {
+			                       return static_cast<size_t>(dynamic_cast_chain(handle));
+		                       });
+		auto const cached = run("handle_kind (" + kind.name + ")", kind.calls, [&handle](size_t) {
+			return static_cast<size_t>(handle_kind(handle));
+		});
+		if (chain != cached) {
+			std::cerr << "handle kinds differ for the " << kind.name << " handle\n";
+			return EXIT_FAILURE;
+		}
+	}
+
+	HICANN::CrossbarRow const switches;
+	for (auto const& target : targets) {
+		Handle::HICANN& handle = *target.handle;
+		run("set_crossbar_switch_row (" + target.name + ")", target.calls,
+		    [&handle, &switches](size_t ii) {
+			    HICANN::set_crossbar_switch_row(
+			        handle, HLineOnHICANN(ii % HLineOnHICANN::size), left, switches);
+			    return size_t(0);
+		    });
+		run("get_crossbar_switch_row (" + target.name + ")", target.calls, [&handle](size_t ii) {
+			auto const row = HICANN::get_crossbar_switch_row(
+			    handle, HLineOnHICANN(ii % HLineOnHICANN::size), left);
+			return static_cast<size_t>(std::count(row.begin(), row.end(), true));
+		});
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,98 @@
+// Microbenchmark of the FG row-to-parameter lookup.
+//
+// Translates all rows of all FG blocks to shared and neuron parameters, as
+// done when forwarding FG values to the ESS, once via the throwing lookups
+// (getSharedParameter, getNeuronParameter) and once via the non-throwing
+// table lookups (findSharedParameter, findNeuronParameter).  Both variants
+// are timed by the harness in halbe_benchmark.h and their checksums compared.
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include <boost/program_options.hpp>
+
+#include "halco/common/iter_all.h"
+#include "halco/hicann/v2/fg.h"
+#include "hal/HICANN/FGBlock.h"
+
+#include "halbe_benchmark.h"
+
+namespace po = boost::program_options;
+
+using namespace HMF::HICANN;
+using namespace halco::hicann::v2;
+using halco::common::iter_all;
+
+namespace {
+
+// checksum over the parameters of connected rows
+template <typename Translate>
+size_t run(std::string const& name, size_t const repetitions, Translate&& translate)
+{
+	return HMF::benchmark::run(name, "lookups", [&]() {
+		HMF::benchmark::Result result{0, 0};
+		for (size_t rep = 0; rep < repetitions; ++rep) {
+			for (auto block : iter_all<FGBlockOnHICANN>()) {
+				for (auto row : iter_all<FGRowOnFGBlock>()) {
+					result.checksum += translate(block, row);
+					result.operations += 2;
+				}
+			}
+		}
+		return result;
+	});
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	size_t repetitions;
+
+	po::options_description desc = HMF::benchmark::options();
+	desc.add_options()
+		("repetitions", po::value<size_t>(&repetitions)->default_value(10000),
+			 "number of translations of all rows of all blocks")
+		;
+	if (!HMF::benchmark::parse_command_line(argc, argv, desc))
+		return EXIT_SUCCESS;
+
+	// the checksums of both variants would trivially agree
+	if (repetitions == 0) {
+		std::cerr << "repetitions must be positive\n";
+		return EXIT_FAILURE;
+	}
+
+	auto const throwing = run(
+	    "get*Parameter (exceptions)", repetitions,
+	    [](FGBlockOnHICANN const& block, FGRowOnFGBlock const& row) {
+		    size_t sum = 0;
+		    try {
+			    sum += 1 + getSharedParameter(block, row);
+		    } catch (std::out_of_range const&) {
+		    }
+		    try {
+			    sum += 100 + getNeuronParameter(block, row);
+		    } catch (std::out_of_range const&) {
+		    }
+		    return sum;
+	    });
+	auto const table = run(
+	    "find*Parameter (tables)", repetitions,
+	    [](FGBlockOnHICANN const& block, FGRowOnFGBlock const& row) {
+		    size_t sum = 0;
+		    if (auto const p = findSharedParameter(block, row))
+			    sum += 1 + *p;
+		    if (auto const p = findNeuronParameter(block, row))
+			    sum += 100 + *p;
+		    return sum;
+	    });
+
+	if (throwing != table) {
+		std::cerr << "lookups differ\n";
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
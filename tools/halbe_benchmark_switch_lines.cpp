@@ -0,0 +1,118 @@
+// Microbenchmark of the line queries of Crossbar and SynapseSwitch.
+//
+// Queries the connected vertical lines of all rows, once by scanning all
+// vertical lines with exists() (and filtering by side for synapse switch
+// rows), as get_lines did before, and once via get_lines, which reads the
+// tables generated at compile time.  Timing and options: halbe_benchmark.h.
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <boost/program_options.hpp>
+
+#include "halco/common/iter_all.h"
+#include "halco/hicann/v2/l1.h"
+#include "halco/hicann/v2/synapse.h"
+#include "hal/HICANN/Crossbar.h"
+#include "hal/HICANN/SynapseSwitch.h"
+
+#include "halbe_benchmark.h"
+
+namespace po = boost::program_options;
+
+using namespace HMF::HICANN;
+using namespace halco::hicann::v2;
+using namespace halco::common;
+
+namespace {
+
+template <typename Matrix>
+typename Matrix::x_lines_type scan_lines(typename Matrix::y_type const& y)
+{
+	typename Matrix::x_lines_type lines;
+	size_t idx = 0;
+	for (size_t xx = 0; xx < Matrix::x_type::end; ++xx) {
+		typename Matrix::x_type const x(xx);
+		if (Matrix::exists(x, y))
+			lines[idx++] = x;
+	}
+	return lines;
+}
+
+SynapseSwitch::x_lines_for_row_type scan_lines(SynapseSwitchRowOnHICANN const& s)
+{
+	SynapseSwitch::x_lines_for_row_type some;
+	auto const all = scan_lines<SynapseSwitch>(s.line());
+	auto const side = s.toSideHorizontal();
+	std::copy_if(all.begin(), all.end(), some.begin(), [&side](VLineOnHICANN const& v) {
+		return !((v < (VLineOnHICANN::end / 2)) xor (side == left));
+	});
+	return some;
+}
+
+template <typename Lines>
+size_t sum(Lines const& lines)
+{
+	size_t ret = 0;
+	for (auto const& line : lines)
+		ret += line;
+	return ret;
+}
+
+// checksum over the returned lines
+template <typename Coordinate, typename Query>
+size_t run(std::string const& name, size_t const repetitions, Query&& query)
+{
+	return HMF::benchmark::run(name, "queries", [&]() {
+		HMF::benchmark::Result result{0, 0};
+		for (size_t rep = 0; rep < repetitions; ++rep) {
+			for (auto const c : iter_all<Coordinate>()) {
+				result.checksum += sum(query(c));
+				++result.operations;
+			}
+		}
+		return result;
+	});
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	size_t repetitions;
+
+	po::options_description desc = HMF::benchmark::options();
+	desc.add_options()
+		("repetitions", po::value<size_t>(&repetitions)->default_value(10000),
+			 "number of queries of all rows")
+		;
+	if (!HMF::benchmark::parse_command_line(argc, argv, desc))
+		return EXIT_SUCCESS;
+
+	if (repetitions == 0) {
+		std::cerr << "repetitions must be positive\n";
+		return EXIT_FAILURE;
+	}
+
+	auto const crossbar_scan = run<HLineOnHICANN>(
+	    "Crossbar scan", repetitions,
+	    [](HLineOnHICANN const& y) { return scan_lines<Crossbar>(y); });
+	auto const crossbar_table = run<HLineOnHICANN>(
+	    "Crossbar::get_lines", repetitions,
+	    [](HLineOnHICANN const& y) { return Crossbar::get_lines(y); });
+
+	auto const synapse_switch_scan = run<SynapseSwitchRowOnHICANN>(
+	    "SynapseSwitch scan", repetitions,
+	    [](SynapseSwitchRowOnHICANN const& s) { return scan_lines(s); });
+	auto const synapse_switch_table = run<SynapseSwitchRowOnHICANN>(
+	    "SynapseSwitch::get_lines", repetitions,
+	    [](SynapseSwitchRowOnHICANN const& s) { return SynapseSwitch::get_lines(s); });
+
+	if (crossbar_scan != crossbar_table || synapse_switch_scan != synapse_switch_table) {
+		std::cerr << "lines differ\n";
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,126 @@
+// Benchmark of the synapse row write throughput per synapse wait mode.
+//
+// Writes synapse weight rows of one HICANN via set_weights_row, once guarding
+// the synapse controller commands by dummy writes and once by polling the
+// controller status (cf. HICANN::set_synapse_wait_mode), and reports rows/s
+// as well as the packets spent on waiting.  Written rows are read back to
+// check both modes.  The rows/s are measured by benchmark::run of the harness
+// shared with the other halbe_benchmark_* tools (halbe_benchmark.h).
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <boost/program_options.hpp>
+
+#include "halco/common/iter_all.h"
+#include "halco/hicann/v2/synapse.h"
+#include "hal/Handle/FPGAHw.h"
+#include "hal/Handle/HICANNHw.h"
+#include "hal/backend/FPGABackend.h"
+#include "hal/backend/HICANNBackend.h"
+
+#include "halbe_benchmark.h"
+
+namespace po = boost::program_options;
+
+using namespace HMF;
+using namespace halco::hicann::v2;
+using namespace halco::common;
+
+namespace {
+
+HICANN::WeightRow weights_for(SynapseRowOnHICANN const& row, size_t const rep)
+{
+	HICANN::WeightRow weights;
+	for (size_t ii = 0; ii < weights.size(); ++ii)
+		weights[ii] = HICANN::SynapseWeight((ii + row.toEnum().value() + rep) % 16);
+	return weights;
+}
+
+// returns the number of rows not read back as written
+size_t run(
+    Handle::HICANNHw& h,
+    HICANN::SynapseWaitMode const mode,
+    std::string const& name,
+    size_t const repetitions)
+{
+	HICANN::SynapseController const synapse_controller;
+	HICANN::set_synapse_wait_mode(h, mode);
+
+	auto& state = h.synapse_controller_state();
+	size_t const dummy_writes = state.dummy_writes;
+	size_t const polls = state.polls;
+
+	benchmark::run(name, "rows", [&]() {
+		benchmark::Result result{0, 0};
+		for (size_t rep = 0; rep < repetitions; ++rep) {
+			for (auto const row : iter_all<SynapseRowOnHICANN>()) {
+				HICANN::set_weights_row(h, synapse_controller, row, weights_for(row, rep));
+				++result.operations;
+			}
+		}
+		HICANN::flush(h);
+		return result;
+	});
+	std::cout << name << ": " << state.dummy_writes - dummy_writes << " dummy writes, "
+	          << state.polls - polls << " status reads\n";
+
+	size_t errors = 0;
+	for (auto const row : {SynapseRowOnHICANN(Enum(0)), SynapseRowOnHICANN(Enum(223)),
+	                       SynapseRowOnHICANN(Enum(224)), SynapseRowOnHICANN(Enum(447))}) {
+		if (HICANN::get_weights_row(h, synapse_controller, row) !=
+		    weights_for(row, repetitions - 1))
+			++errors;
+	}
+	return errors;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	std::string fpga_ip, pmu_ip, on;
+	Enum d, w, hicann;
+	size_t repetitions;
+
+	po::options_description desc = benchmark::options();
+	desc.add_options()
+		("fpga_ip", po::value<std::string>(&fpga_ip)->required(), "specify FPGA ip")
+		("pmu_ip", po::value<std::string>(&pmu_ip)->default_value("0.0.0.0"), "specify PMU ip")
+		("on", po::value<std::string>(&on)->default_value("vertical"),
+			 "specify hardware backend [[w]afer,[v]ertical]")
+		("dnc", po::value<Enum>(&d)->default_value(Enum(1)), "specify DNC (FPGA-local enum)")
+		("hicann", po::value<Enum>(&hicann)->default_value(Enum(0)),
+			 "specify HICANN (DNC-local enum)")
+		("wafer", po::value<Enum>(&w)->default_value(Enum(0)), "specify Wafer number")
+		("repetitions", po::value<size_t>(&repetitions)->default_value(10),
+			 "number of writes of all synapse rows per mode")
+		;
+	if (!benchmark::parse_command_line(argc, argv, desc))
+		return EXIT_SUCCESS;
+
+	if (repetitions == 0) {
+		std::cerr << "repetitions must be positive\n";
+		return EXIT_FAILURE;
+	}
+
+	bool const on_wafer = (on.at(0) == 'w' || on.at(0) == 'W');
+	Handle::FPGAHw f(
+	    FPGAGlobal(FPGAOnWafer(), Wafer(w)), IPv4::from_string(fpga_ip), DNCOnFPGA(d),
+	    IPv4::from_string(pmu_ip), on_wafer);
+	Handle::HICANNHw& h = *f.get(DNCOnFPGA(d), HICANNOnDNC(hicann));
+
+	FPGA::reset(f);
+	HICANN::init(h, false);
+
+	size_t errors = 0;
+	errors += run(h, HICANN::SynapseWaitMode::dummy_writes, "dummy writes", repetitions);
+	errors += run(h, HICANN::SynapseWaitMode::status_polling, "status polling", repetitions);
+
+	if (errors) {
+		std::cerr << errors << " rows not read back as written\n";
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
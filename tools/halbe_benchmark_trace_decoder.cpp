@@ -0,0 +1,153 @@
+// Microbenchmark of the FPGA trace decoders.
+//
+// Decodes a recorded trace (raw 64 bit payload words of FPGATRACE packets as
+// little-endian binary file) or a synthetic trace and reports the decode rate
+// of the entry-wise and the batch decoder, timed by the harness of
+// halbe_benchmark.h (fastest of several repetitions).
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include "halco/hicann/v2/external.h"
+#include "hal/backend/FPGATraceDecoder.h"
+
+#include "halbe_benchmark.h"
+
+namespace po = boost::program_options;
+
+using HMF::FPGA::TraceDecoder;
+
+namespace {
+
+std::vector<std::uint64_t> read_trace(std::string const& filename)
+{
+	std::ifstream file(filename, std::ios::binary | std::ios::ate);
+	if (!file) {
+		throw std::runtime_error("cannot open " + filename);
+	}
+	std::vector<std::uint64_t> words(file.tellg() / sizeof(std::uint64_t));
+	file.seekg(0);
+	file.read(reinterpret_cast<char*>(words.data()), words.size() * sizeof(std::uint64_t));
+	return words;
+}
+
+// pulse events with increasing timestamps, overflow indicators and end-of-trace marker
+std::vector<std::uint64_t> synthesize_trace(size_t const num_events, unsigned const seed)
+{
+	std::mt19937 rng(seed);
+	std::uniform_int_distribution<std::uint32_t> label(0, 0xfff);
+	std::uniform_int_distribution<std::uint32_t> isi(0, 16);
+
+	std::vector<std::uint64_t> words;
+	words.reserve(num_events / 2 + 2);
+
+	std::uint64_t time = 0;
+	std::uint64_t overflow_count = 0;
+	std::vector<std::uint32_t> entries;
+	for (size_t ii = 0; ii < num_events; ++ii) {
+		time += isi(rng);
+		while ((time >> TraceDecoder::event_timestamp_bits) > overflow_count) {
+			// overflow indicators occupy the upper half of a word
+			if (entries.size() % 2 == 0) {
+				entries.push_back(1u << 30);
+			}
+			entries.push_back((1u << 31) | ++overflow_count);
+		}
+		std::uint32_t const fpga_msb = (time >> (TraceDecoder::event_timestamp_bits - 1)) & 1;
+		entries.push_back(
+		    static_cast<std::uint32_t>(time % TraceDecoder::max_timestamp_cnt) |
+		    (label(rng) << TraceDecoder::event_timestamp_bits) | (fpga_msb << 29));
+	}
+	if (entries.size() % 2) {
+		entries.push_back(1u << 30);
+	}
+	for (size_t ii = 0; ii < entries.size(); ii += 2) {
+		words.push_back(
+		    static_cast<std::uint64_t>(entries[ii]) |
+		    (static_cast<std::uint64_t>(entries[ii + 1]) << 32));
+	}
+	words.push_back(TraceDecoder::end_of_trace_marker);
+	return words;
+}
+
+// returns the pulse events decoded by the last repetition
+template <typename Decode>
+TraceDecoder::container_type run(
+    std::string const& name,
+    std::vector<std::uint64_t> const& trace,
+    size_t const packet_words,
+    size_t const repetitions,
+    Decode&& decode)
+{
+	TraceDecoder::container_type pulse_events;
+	HMF::benchmark::run(name, "events", repetitions, [&]() {
+		TraceDecoder decoder{halco::hicann::v2::FPGAGlobal(halco::common::Enum(0))};
+		pulse_events = TraceDecoder::container_type();
+		for (size_t ii = 0; ii < trace.size(); ii += packet_words) {
+			size_t const len = std::min(packet_words, trace.size() - ii);
+			decode(decoder, trace.data() + ii, len, pulse_events);
+		}
+		return HMF::benchmark::Result{pulse_events.size(), 0};
+	});
+	return pulse_events;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	std::string input;
+	size_t packet_words;
+	size_t num_events;
+	size_t repetitions;
+	unsigned seed;
+
+XX, po::value<std::string>(&input),
+			 "recorded trace (raw 64 bit payload words), synthetic trace if not given")
+		("packet_words", po::value<size_t>(&packet_words)->default_value(176),
+			 "number of 64 bit words per packet")
+		("events", po::value<size_t>(&num_events)->default_value(10000000),
+			 "number of pulse events of synthetic trace")
+		("repetitions", po::value<size_t>(&repetitions)->default_value(10),
+			 "number of repetitions (best one is reported)")
+		("seed", po::value<unsigned>(&seed)->default_value(1234),
+			 "seed of synthetic trace")
+		;
+
+	if (!HMF::benchmark::parse_command_line(argc, argv, desc))
+		return EXIT_SUCCESS;
+
+	if (packet_words == 0 || repetitions == 0) {
+		std::cerr << "packet_words and repetitions have to be non-zero\n";
+		return EXIT_FAILURE;
+	}
+
+	std::vector<std::uint64_t> const trace =
+	    !input.empty() ? read_trace(input) : synthesize_trace(num_events, seed);
+	std::cout << "trace of " << trace.size() << " words in packets of " << packet_words
+	          << " words\n";
+
+	auto const entries = run(
+	    "decode_entries", trace, packet_words, repetitions,
+	    [](TraceDecoder& d, std::uint64_t const* pdu, size_t len,
+	       TraceDecoder::container_type& events) { d.decode_entries(pdu, len, events); });
+	auto const batch = run(
+	    "decode_batch", trace, packet_words, repetitions,
+	    [](TraceDecoder& d, std::uint64_t const* pdu, size_t len,
+	       TraceDecoder::container_type& events) { d.decode_batch(pdu, len, events); });
+
+	if (entries != batch) {
+		std::cerr << "decoded pulse events differ\n";
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
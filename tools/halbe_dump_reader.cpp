@@ -0,0 +1,88 @@
+// Inspects binary dumps written by Handle::Dump::enableBinaryDump.
+//
+// Only the index and the requested records are read, hence even huge dumps
+// can be listed or searched quickly.  For replaying calls, deserialize their
+// arguments via HMF::Handle::BinaryDumpReader::load.
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+
+#include <boost/program_options.hpp>
+
+#include "hal/Handle/dump/binary_dump.h"
+
+namespace po = boost::program_options;
+
+using HMF::Handle::BinaryDumpReader;
+
+int main(int argc, char* argv[])
+{
+	std::string input;
+	std::string function;
+	size_t first;
+	size_t count;
+
+	po::options_description desc("Allowed options");
+	desc.add_options()
+		("help", "produce help message")
+		("input", po::value<std::string>(&input)->required(), "binary dump")
+		("function", po::value<std::string>(&function),
+			 "only consider calls of this function (e.g. set_fg_valuesIMPL)")
+		("first", po::value<size_t>(&first)->default_value(0), "index of first call to consider")
+		("count", po::value<size_t>(&count)->default_value(0),
+			 "maximum number of calls to consider, 0 means all")
+		("stats", "print number of calls and payload size per function instead of a list of calls")
+		("hex", "print payload of listed calls")
+		;
+
+	po::positional_options_description pos;
+	pos.add("input", 1);
+
+	po::variables_map vm;
+	po::store(po::command_line_parser(argc, argv).options(desc).positional(pos).run(), vm);
+	if (vm.count("help")) {
+		std::cout << desc << "\n";
+		return EXIT_SUCCESS;
+	}
+	po::notify(vm);
+
+	BinaryDumpReader const reader(input);
+
+	size_t const last = count ? std::min(reader.size(), first + count) : reader.size();
+	std::map<std::string, std::pair<size_t, size_t> > stats;
+
+	for (size_t call = first; call < last; ++call) {
+		std::string const name = reader.name(call);
+		if (!function.empty() && name != function) {
+			continue;
+		}
+
+		if (vm.count("stats")) {
+			auto& entry = stats[name];
+			entry.first++;
+			entry.second += reader.payload(call).size();
+			continue;
+		}
+
+		std::cout << call << "\t" << name;
+		if (vm.count("hex")) {
+			std::cout << "\t" << std::hex << std::setfill('0');
+			for (unsigned char const byte : reader.payload(call)) {
+				std::cout << std::setw(2) << static_cast<unsigned>(byte);
+			}
+			std::cout << std::dec;
+		}
+		std::cout << "\n";
+	}
+
+	for (auto const& entry : stats) {
+		std::cout << entry.first << "\t" << entry.second.first << " calls\t"
+		          << entry.second.second << " bytes\n";
+	}
+	std::cout << reader.size() << " calls in total\n";
+	return EXIT_SUCCESS;
+}